@@ -13,9 +13,14 @@
 #include <iomanip>
 #include <limits>
 #include <atomic>
-#include <mutex>
+#include <future>
+#include <memory>
+#include <sstream>
 
-#ifndef WIN32
+#ifdef _WIN32
+#include <conio.h>
+#else
+#include <sys/select.h>
 #include <unistd.h>
 #endif
 
@@ -30,10 +35,10 @@ private:
     Robot* robot;
     SLAM* slam;
     MapManager* map_manager;
-    bool connected;
-    std::thread* monitor_thread;      // 连接监控线程
-    std::atomic<bool> should_monitor;  // 是否继续监控
-    mutable std::mutex robot_mutex;    // 保护 robot 和 connected 的互斥锁
+    std::atomic<bool> connected;       // 由连接状态事件更新
+    static const size_t RECENT_POINTS = 5;
+    MappingPathPoint recent_points[RECENT_POINTS];  // 最近的建图路径点 (环形缓冲区)
+    uint64_t mapping_cursor;                        // 建图路径点增量游标，即已获取的路径点总数
 
     /**
      * @brief 清除输入缓冲区
@@ -43,6 +48,35 @@ private:
         std::cin.ignore(std::numeric_limits<std::streamsize>::max(), '\n');
     }
 
+    /**
+     * @brief 等待键盘输入
+     * 先检查std::cin已缓冲的数据，select()/_kbhit()看不到这部分输入
+     * @param timeout_ms 最长等待时间（毫秒）
+     * @return true表示有输入可读
+     */
+    bool waitForInput(int timeout_ms) {
+        if (std::cin.rdbuf()->in_avail() > 0) {
+            return true;
+        }
+#ifdef _WIN32
+        for (int waited = 0; waited < timeout_ms; waited += 50) {
+            if (_kbhit()) {
+                return true;
+            }
+            std::this_thread::sleep_for(std::chrono::milliseconds(50));
+        }
+        return _kbhit() != 0;
+#else
+        fd_set fds;
+        FD_ZERO(&fds);
+        FD_SET(STDIN_FILENO, &fds);
+        timeval tv;
+        tv.tv_sec = timeout_ms / 1000;
+        tv.tv_usec = (timeout_ms % 1000) * 1000;
+        return select(STDIN_FILENO + 1, &fds, nullptr, nullptr, &tv) > 0;
+#endif
+    }
+
     /**
      * @brief 获取SLAM工作模式字符串
      */
@@ -93,20 +127,10 @@ private:
 
 public:
     MappingCLI() : robot(nullptr), slam(nullptr), map_manager(nullptr), connected(false),
-                   monitor_thread(nullptr), should_monitor(false) {
+                   mapping_cursor(0) {
     }
 
     ~MappingCLI() {
-        // 停止监控线程
-        if (monitor_thread) {
-            should_monitor = false;
-            if (monitor_thread->joinable()) {
-                monitor_thread->join();
-            }
-            delete monitor_thread;
-            monitor_thread = nullptr;
-        }
-
         if (slam) delete slam;
         if (map_manager) delete map_manager;
         if (robot) {
@@ -118,18 +142,15 @@ public:
     // ============ 连接管理 ============
 
     /**
-     * @brief 连接监控线程函数
-     * 持续检查连接状态并更新全局变量
+     * @brief 获取连接状态字符串
      */
-    void monitorConnection() {
-        while (should_monitor) {
-            {
-                std::lock_guard<std::mutex> lock(robot_mutex);
-                if (robot) {
-                    connected = robot->isConnected();
-                }
-            }
-            std::this_thread::sleep_for(std::chrono::milliseconds(200));
+    std::string getConnectionStateString(ConnectionState state) const {
+        switch (state) {
+            case ConnectionState::DISCONNECTED: return "未连接";
+            case ConnectionState::CONNECTING:   return "连接中";
+            case ConnectionState::CONNECTED:    return "已连接";
+            case ConnectionState::RECONNECTING: return "重连中";
+            default:                            return "未知";
         }
     }
 
@@ -137,7 +158,6 @@ public:
      * @brief 线程安全地检查连接状态
      */
     bool isConnected() const {
-        std::lock_guard<std::mutex> lock(robot_mutex);
         return connected;
     }
 
@@ -145,7 +165,7 @@ public:
      * @brief 连接到机器人
      */
     void connectToRobot(const std::string& ip) {
-        if (isConnected() || monitor_thread) {
+        if (robot) {
             std::cout << "已连接到机器人，请先断开连接。" << std::endl;
             return;
         }
@@ -154,10 +174,17 @@ public:
         std::cout << "[DEBUG] 创建 Robot 对象..." << std::endl;
         robot = new Robot(ip);
 
+        // 订阅连接状态事件，断线后SDK自动按退避策略重连
+        robot->subscribeConnectionState([this](ConnectionState state) {
+            connected = (state == ConnectionState::CONNECTED);
+            std::cout << "\n[事件] 连接状态: " << getConnectionStateString(state) << std::endl;
+        });
+
         try {
             std::cout << "[DEBUG] 调用 robot->connect()..." << std::endl;
             robot->connect();
             std::cout << "[DEBUG] connect() 返回成功" << std::endl;
+            connected = robot->isConnected();
 
             // 创建 SLAM 和 MapManager
             std::cout << "[DEBUG] 创建 SLAM..." << std::endl;
@@ -171,10 +198,6 @@ public:
                 map_manager = new MapManager();
             }
             std::cout << "[DEBUG] MapManager 创建完成" << std::endl;
-
-            // 启动监控线程，持续检查连接状态
-            should_monitor = true;
-            monitor_thread = new std::thread(&MappingCLI::monitorConnection, this);
         } catch (const std::exception& e) {
             std::cout << "连接异常: " << e.what() << std::endl;
             delete robot;
@@ -190,30 +213,14 @@ public:
      * @brief 断开机器人连接
      */
     void disconnect() {
-        // 停止监控线程
-        if (monitor_thread) {
-            should_monitor = false;
-            if (monitor_thread->joinable()) {
-                monitor_thread->join();
-            }
-            delete monitor_thread;
-            monitor_thread = nullptr;
+        if (!robot) {
+            return;
         }
 
-        {
-            std::lock_guard<std::mutex> lock(robot_mutex);
-            if (!connected && !robot) {
-                return;
-            }
-
-            if (robot) {
-                robot->disconnect();
-                delete robot;
-                robot = nullptr;
-            }
-
-            connected = false;
-        }
+        robot->disconnect();
+        delete robot;
+        robot = nullptr;
+        connected = false;
 
         // 断开连接时释放 SLAM 和 MapManager
         if (slam) {
@@ -275,6 +282,7 @@ public:
         }
 
         try {
+            mapping_cursor = 0;
             slam->startMapping(scene_name, type);
             std::this_thread::sleep_for(std::chrono::milliseconds(500));
 
@@ -308,14 +316,70 @@ public:
         std::cout << "正在保存建图数据..." << std::endl;
 
         try {
+            // 通过进度事件等待保存结束
+            auto done = std::make_shared<std::promise<MapSaveStage>>();
+            auto finished = std::make_shared<std::atomic<bool>>(false);
+            slam->subscribeMapSaveProgress([done, finished](MapSaveProgress progress) {
+                // 回调在SDK线程中执行，先格式化到本地缓冲区再一次性输出
+                std::ostringstream line;
+                line << "\r保存进度: " << std::fixed << std::setprecision(1)
+                     << progress.percent << "%";
+                if (progress.eta >= 0) {
+                    line << ", 预计剩余 " << std::setprecision(0) << progress.eta << " 秒";
+                }
+                line << "    ";
+                std::cout << line.str() << std::flush;
+
+                if (progress.stage == MapSaveStage::DONE ||
+                    progress.stage == MapSaveStage::CANCELLED ||
+                    progress.stage == MapSaveStage::FAILED) {
+                    if (!finished->exchange(true)) {
+                        done->set_value(progress.stage);
+                    }
+                }
+            });
+
+            std::future<MapSaveStage> result = done->get_future();
             slam->finishMapping();
-            // 等待保存完成
-            std::this_thread::sleep_for(std::chrono::seconds(2));
+            std::cout << "输入 c 并回车可取消保存" << std::endl;
+
+            // 短周期轮询，每轮只等待一次：取消前等待键盘输入，取消后等待保存结束
+            auto deadline = std::chrono::steady_clock::now() + std::chrono::minutes(30);
+            bool cancel_requested = false;
+            while (result.wait_for(std::chrono::milliseconds(0)) != std::future_status::ready &&
+                   std::chrono::steady_clock::now() < deadline) {
+                if (cancel_requested) {
+                    result.wait_for(std::chrono::milliseconds(200));
+                    continue;
+                }
+                if (!waitForInput(200)) {
+                    continue;
+                }
+                std::string input;
+                std::getline(std::cin, input);
+                if (input == "c" || input == "C") {
+                    if (slam->cancelMapSaving()) {
+                        std::cout << "\n正在取消保存..." << std::endl;
+                        cancel_requested = true;
+                    } else {
+                        std::cout << "\n当前无法取消保存。" << std::endl;
+                    }
+                }
+            }
+            slam->subscribeMapSaveProgress(nullptr);
 
-            if (!slam->isMapping()) {
-                std::cout << "建图已保存!" << std::endl;
+            if (result.wait_for(std::chrono::milliseconds(0)) != std::future_status::ready) {
+                std::cout << "\n建图保存超时，仍在进行中..." << std::endl;
             } else {
-                std::cout << "建图保存可能仍在进行中..." << std::endl;
+                MapSaveStage stage = result.get();
+                if (stage == MapSaveStage::DONE) {
+                    std::cout << "\n建图已保存!" << std::endl;
+                } else if (stage == MapSaveStage::CANCELLED) {
+                    std::cout << "\n建图保存已取消，可继续建图或重新保存。" << std::endl;
+                } else {
+                    SLAMErrorCode error = slam->getErrorCode();
+                    std::cout << "\n建图保存未完成! 错误: " << getErrorCodeString(error) << std::endl;
+                }
             }
         } catch (const std::exception& e) {
             std::cout << "异常: " << e.what() << std::endl;
@@ -340,16 +404,23 @@ public:
         std::cout << "状态: " << getErrorCodeString(error) << std::endl;
         std::cout << "建图中: " << (slam->isMapping() ? "是" : "否") << std::endl;
 
-        // 显示建图路径点
-        auto path_points = slam->getMappingPathPoints();
-        if (!path_points.empty()) {
-            std::cout << "\n建图路径点数量: " << path_points.size() << std::endl;
-            std::cout << "最新5个路径点:" << std::endl;
-            size_t count = std::min(size_t(5), path_points.size());
-            for (size_t i = path_points.size() - count; i < path_points.size(); ++i) {
+        // 增量获取建图路径点，本地只保留计数和最近几个点，内存占用不随建图时长增长
+        uint64_t cursor = mapping_cursor;
+        auto new_points = slam->getMappingPathPointsSince(cursor);
+        for (size_t i = 0; i < new_points.size(); ++i) {
+            recent_points[(mapping_cursor + i) % RECENT_POINTS] = new_points[i];
+        }
+        mapping_cursor = cursor;
+
+        if (mapping_cursor > 0) {
+            std::cout << "\n建图路径点数量: " << mapping_cursor << std::endl;
+            std::cout << "最新" << RECENT_POINTS << "个路径点:" << std::endl;
+            uint64_t count = mapping_cursor < RECENT_POINTS ? mapping_cursor : uint64_t(RECENT_POINTS);
+            for (uint64_t i = mapping_cursor - count; i < mapping_cursor; ++i) {
+                const MappingPathPoint& point = recent_points[i % RECENT_POINTS];
                 std::cout << "  [" << i << "] x: " << std::fixed << std::setprecision(3)
-                          << path_points[i].x << ", y: " << path_points[i].y
-                          << ", z: " << path_points[i].z << std::endl;
+                          << point.x << ", y: " << point.y
+                          << ", z: " << point.z << std::endl;
             }
         }
     }
@@ -2,12 +2,17 @@
 #define QUADRUPED_SDK_CHARGING_AUTO_CHARGE_HPP
 
 #include "../common/types.hpp"
+#include <future>
 #include <cstdint>
+#include <functional>
 #include <string>
 
 namespace robot {
 namespace q25 {
 
+// 前向声明
+class Robot;
+
 /**
  * 充电状态枚举
  * 对应 CMS::AutoChargeStatus
@@ -52,6 +57,32 @@ struct AutoChargeInfo {
     double timestamp;           // 时间戳
 };
 
+/**
+ * 充电阶段重试策略
+ * 重试次数为0表示该阶段失败后不重试；过温/过压/过流保护不重试
+ */
+struct ChargeRetryPolicy {
+    uint32_t guide_to_point_retries = 1;    // 路径规划或引导至充电点失败的重试次数
+    uint32_t guide_to_pile_retries = 2;     // 引导至充电桩失败的重试次数
+    uint32_t squat_retries = 2;             // 下蹲失败的重试次数
+    uint32_t exit_pile_retries = 2;         // 退桩失败的重试次数
+    uint32_t retry_delay_ms = 3000;         // 失败后到重试的等待时间 (毫秒)
+    bool realign_before_pile_retry = true;  // 入桩或下蹲重试前先退回充电点重新对准
+};
+
+/**
+ * 充电状态跳变事件
+ */
+struct ChargeTransitionEvent {
+    ChargeStatus previous;      // 跳变前状态
+    AutoChargeInfo current;     // 跳变后的充电信息
+    uint32_t attempt;           // 当前阶段的尝试次数 (首次为1)
+    bool will_retry;            // 失败状态是否将按重试策略自动重试
+};
+
+// 充电状态跳变事件回调类型
+using ChargeTransitionCallback = std::function<void(ChargeTransitionEvent)>;
+
 /**
  * AutoCharge - 自主充电接口
  * 提供自主充电控制功能
@@ -59,7 +90,17 @@ struct AutoChargeInfo {
  */
 class AutoCharge {
 public:
+    /**
+     * 构造函数，绑定到默认机器人实例 (进程内首个创建的Robot)
+     */
     AutoCharge();
+
+    /**
+     * 构造函数，绑定到指定机器人实例
+     * 同一进程可为多个Robot分别创建模块对象
+     * @param robot 机器人实例 (生命周期须长于本对象)
+     */
+    explicit AutoCharge(Robot& robot);
     ~AutoCharge();
 
     // 禁用复制
@@ -80,6 +121,26 @@ public:
      */
     bool stopCharge();
 
+    /**
+     * 单独执行一个充电阶段
+     * 用于人工介入后从中间阶段继续，如已在充电点附近时直接入桩，或单独退桩；
+     * 该阶段失败时同样按重试策略重试
+     * @param type 充电任务类型
+     * @return true表示任务启动成功
+     */
+    bool runChargeTask(ChargeTaskType type);
+
+    /**
+     * 设置失败阶段的自动重试策略
+     * @param policy 重试策略
+     */
+    void setRetryPolicy(const ChargeRetryPolicy& policy);
+
+    /**
+     * 获取当前重试策略
+     */
+    ChargeRetryPolicy getRetryPolicy() const;
+
     // ============ 状态查询 ============
 
     /**
@@ -94,6 +155,38 @@ public:
      */
     bool isCharging() const;
 
+    /**
+     * 获取自主充电信息 (状态、是否充电、电量)
+     * @return 充电信息
+     */
+    AutoChargeInfo getAutoChargeInfo() const;
+
+    /**
+     * 订阅充电状态跳变事件
+     * 每次状态变化上报一次，包括自动重试产生的状态回退；
+     * 重试次数用尽或进入保护状态时will_retry为false，需人工处理
+     * @param callback 事件回调函数，传入空回调取消订阅
+     */
+    void subscribeChargeTransition(ChargeTransitionCallback callback);
+
+    // ============ 异步命令 ============
+    // future在机器人接受命令后就绪，充电过程请通过subscribeChargeTransition()跟踪
+
+    /**
+     * startCharge()的异步版本
+     */
+    std::future<bool> startChargeAsync();
+
+    /**
+     * stopCharge()的异步版本
+     */
+    std::future<bool> stopChargeAsync();
+
+    /**
+     * runChargeTask()的异步版本
+     */
+    std::future<bool> runChargeTaskAsync(ChargeTaskType type);
+
 private:
     struct Impl;
     Impl* impl_;
@@ -0,0 +1,350 @@
+#ifndef QUADRUPED_SDK_CHARGING_ENERGY_MODEL_HPP
+#define QUADRUPED_SDK_CHARGING_ENERGY_MODEL_HPP
+
+#include "../common/types.hpp"
+#include "../navigation/point_navigation.hpp"
+#include "../navigation/waypoint_graph.hpp"
+#include "../sensor/battery.hpp"
+#include "../system/system_info.hpp"
+#include <cmath>
+#include <cstdint>
+#include <vector>
+
+namespace robot {
+namespace q25 {
+
+/**
+ * 能耗模型参数
+ * 先验参数在积累足够历史前使用，应按实际机型标定
+ */
+struct EnergyModelOptions {
+    float prior_energy_per_meter = 250.0f;  // 先验行走能耗 (焦耳/米)
+    float prior_idle_power = 150.0f;        // 先验站立功耗 (瓦)
+    float prior_speed_low = 0.5f;           // 先验低速档平均速度 (米/秒)
+    float prior_speed_high = 1.0f;          // 先验高速档平均速度 (米/秒)
+    float prior_wh_per_percent = 5.0f;      // 先验每1%电量对应的能量 (瓦时)
+    float prior_weight = 30.0f;             // 先验权重 (等效米/秒的观测量)
+    float sample_interval = 10.0f;          // 拟合采样窗口 (秒)
+    float forgetting_factor = 0.995f;       // 历史遗忘因子 (0-1)，每个窗口衰减一次
+    float reserve_percent = 15.0f;          // 任务结束返回充电桩后须保留的电量 (%)
+};
+
+/**
+ * 任务能耗需求
+ */
+struct EnergyMission {
+    float distance;             // 任务行走距离 (米)
+    float dwell_time;           // 任务中的停留时间 (秒)
+    float return_distance;      // 任务结束后返回充电桩的距离 (米)
+    GaitType gait;              // 执行任务的步态
+    SpeedLevel speed_level;     // 执行任务的速度档位
+};
+
+/**
+ * 任务能耗预测
+ */
+struct EnergyEstimate {
+    float duration;             // 预计耗时 (秒，含返回)
+    float energy_wh;            // 预计能耗 (瓦时，含返回)
+    float required_percent;     // 预计消耗电量 (%)
+    float remaining_percent;    // 返回充电桩后的剩余电量 (%)
+    bool feasible;              // 剩余电量是否不低于保留电量
+};
+
+/**
+ * EnergyModel - 能耗模型
+ * 由电池电压电流积分得到实际能耗，由里程统计得到行走距离，
+ * 按步态与速度档位分别拟合 能耗 = 每米能耗 × 距离 + 站立功耗 × 时间，
+ * 并学习每1%电量对应的能量，据此判断任务 (含返回充电桩) 在当前电量下是否可行
+ * 纯本地计算，不依赖机器人连接；update()与查询须在同一线程或由调用方加锁
+ */
+class EnergyModel {
+public:
+    /**
+     * 构造函数
+     * @param options 模型参数
+     */
+    explicit EnergyModel(const EnergyModelOptions& options = EnergyModelOptions())
+        : options_(options) {
+        reset();
+    }
+
+    /**
+     * 输入一次采样 (建议1Hz以上)
+     * 充电期间、步态或档位切换时只重置积分，不参与拟合
+     * @param timestamp 采样时刻 (秒，单调递增)
+     * @param battery 电池状态 (BatterySensor::getBatteryInfo())
+     * @param stats 运动统计 (SystemInfo::getMotionStatistics())
+     * @param gait 当前步态 (MotionController::getGait())
+     * @param speed_level 当前速度档位 (MotionController::getSpeedLevel())
+     */
+    void update(double timestamp, const BatteryInfo& battery, const MotionStatistics& stats,
+                GaitType gait, SpeedLevel speed_level) {
+        int bucket = bucketIndex(gait, speed_level);
+        float power = std::fabs(battery.voltage * battery.current);
+        if (!has_sample_ || battery.is_charging || bucket != bucket_ || !(timestamp > last_time_) ||
+            stats.total_mileage < last_mileage_) {
+            startWindow(timestamp, battery, stats, bucket, power);
+            return;
+        }
+
+        float dt = static_cast<float>(timestamp - last_time_);
+        float energy = 0.5f * (power + last_power_) * dt;
+        window_energy_ += energy;
+        window_distance_ += stats.total_mileage - last_mileage_;
+        window_time_ += dt;
+        percent_energy_ += energy;
+        if (battery.percentage < percent_mark_) {
+            // 电量每下降若干个百分点更新一次容量估计；
+            // 重置后的首次下降只对齐起点，此前的能量不足整个百分点，不计入
+            if (percent_aligned_) {
+                float wh = percent_energy_ / 3600.0f / (percent_mark_ - battery.percentage);
+                percent_sum_ = percent_sum_ * options_.forgetting_factor + wh;
+                percent_count_ = percent_count_ * options_.forgetting_factor + 1.0f;
+            }
+            percent_aligned_ = true;
+            percent_energy_ = 0.0f;
+            percent_mark_ = battery.percentage;
+        } else if (battery.percentage > percent_mark_) {
+            percent_aligned_ = false;
+            percent_energy_ = 0.0f;
+            percent_mark_ = battery.percentage;
+        }
+        last_time_ = timestamp;
+        last_power_ = power;
+        last_mileage_ = stats.total_mileage;
+
+        if (window_time_ >= options_.sample_interval) {
+            fitWindow();
+        }
+    }
+
+    /**
+     * 获取指定步态与档位的每米能耗
+     * @return 每米能耗 (焦耳/米)
+     */
+    float getEnergyPerMeter(GaitType gait, SpeedLevel speed_level) const {
+        float k = 0.0f, p = 0.0f;
+        solve(buckets_[bucketIndex(gait, speed_level)], k, p);
+        return k;
+    }
+
+    /**
+     * 获取站立功耗 (各步态与档位的加权平均)
+     * @return 站立功耗 (瓦)
+     */
+    float getIdlePower() const {
+        float sum = 0.0f, weight = 0.0f;
+        for (int i = 0; i < BUCKET_COUNT; ++i) {
+            float k = 0.0f, p = 0.0f;
+            solve(buckets_[i], k, p);
+            float w = buckets_[i].tt + options_.prior_weight * options_.prior_weight;
+            sum += p * w;
+            weight += w;
+        }
+        return sum / weight;
+    }
+
+    /**
+     * 获取指定步态与档位的平均行走速度
+     * @return 平均速度 (米/秒)
+     */
+    float getAverageSpeed(GaitType gait, SpeedLevel speed_level) const {
+        const Bucket& b = buckets_[bucketIndex(gait, speed_level)];
+        float prior = speed_level == SpeedLevel::HIGH ? options_.prior_speed_high : options_.prior_speed_low;
+        return (b.moving_distance + prior * options_.prior_weight) / (b.moving_time + options_.prior_weight);
+    }
+
+    /**
+     * 获取每1%电量对应的能量
+     * @return 能量 (瓦时)
+     */
+    float getWhPerPercent() const {
+        const float w = 3.0f;   // 先验等效为3次观测
+        return (percent_sum_ + options_.prior_wh_per_percent * w) / (percent_count_ + w);
+    }
+
+    /**
+     * 预测任务能耗并判断可行性
+     * @param mission 任务能耗需求
+     * @param battery_percentage 当前电量 (%)
+     * @return 能耗预测
+     */
+    EnergyEstimate estimate(const EnergyMission& mission, float battery_percentage) const {
+        EnergyEstimate result = EnergyEstimate();
+        float k = 0.0f, p = 0.0f;
+        solve(buckets_[bucketIndex(mission.gait, mission.speed_level)], k, p);
+        float distance = mission.distance + mission.return_distance;
+        float moving_time = distance / getAverageSpeed(mission.gait, mission.speed_level);
+        float idle_time = mission.dwell_time > 0.0f ? mission.dwell_time : 0.0f;
+        float joules = k * distance + p * moving_time + getIdlePower() * idle_time;
+
+        result.duration = moving_time + idle_time;
+        result.energy_wh = joules / 3600.0f;
+        result.required_percent = result.energy_wh / getWhPerPercent();
+        result.remaining_percent = battery_percentage - result.required_percent;
+        result.feasible = result.remaining_percent >= options_.reserve_percent;
+        return result;
+    }
+
+    /**
+     * 清空历史并恢复先验参数
+     */
+    void reset() {
+        for (int i = 0; i < BUCKET_COUNT; ++i) {
+            buckets_[i] = Bucket();
+        }
+        has_sample_ = false;
+        bucket_ = 0;
+        last_time_ = 0.0;
+        last_power_ = 0.0f;
+        last_mileage_ = 0.0f;
+        window_energy_ = window_distance_ = window_time_ = 0.0f;
+        percent_energy_ = 0.0f;
+        percent_mark_ = 0;
+        percent_aligned_ = false;
+        percent_sum_ = percent_count_ = 0.0f;
+    }
+
+private:
+    // 最小二乘正规方程 (距离d、时间t对能耗E)
+    struct Bucket {
+        Bucket() : dd(0), dt(0), tt(0), de(0), te(0), moving_distance(0), moving_time(0) {}
+        float dd, dt, tt;   // Σd², Σd·t, Σt²
+        float de, te;       // Σd·E, Σt·E
+        float moving_distance;
+        float moving_time;
+    };
+
+    // 按 步态×2+档位 分桶
+    static constexpr int BUCKET_COUNT = 4;
+    static_assert(static_cast<int>(GaitType::RUN) * 2 + static_cast<int>(SpeedLevel::HIGH) + 1 == BUCKET_COUNT,
+                  "BUCKET_COUNT must cover every GaitType and SpeedLevel combination");
+
+    static int bucketIndex(GaitType gait, SpeedLevel speed_level) {
+        return static_cast<int>(gait) * 2 + static_cast<int>(speed_level);
+    }
+
+    void startWindow(double timestamp, const BatteryInfo& battery, const MotionStatistics& stats,
+                     int bucket, float power) {
+        has_sample_ = !battery.is_charging;
+        bucket_ = bucket;
+        last_time_ = timestamp;
+        last_power_ = power;
+        last_mileage_ = stats.total_mileage;
+        window_energy_ = window_distance_ = window_time_ = 0.0f;
+        percent_energy_ = 0.0f;
+        percent_mark_ = battery.percentage;
+        percent_aligned_ = false;
+    }
+
+    void fitWindow() {
+        const float lambda = options_.forgetting_factor;
+        Bucket& b = buckets_[bucket_];
+        float d = window_distance_;
+        float t = window_time_;
+        b.dd = b.dd * lambda + d * d;
+        b.dt = b.dt * lambda + d * t;
+        b.tt = b.tt * lambda + t * t;
+        b.de = b.de * lambda + d * window_energy_;
+        b.te = b.te * lambda + t * window_energy_;
+        if (d > 0.1f * t) {
+            // 仅统计实际行走的窗口，避免站立时间拉低平均速度
+            b.moving_distance = b.moving_distance * lambda + d;
+            b.moving_time = b.moving_time * lambda + t;
+        }
+        window_energy_ = window_distance_ = window_time_ = 0.0f;
+    }
+
+    // 先验作为伪观测加入正规方程求解
+    void solve(const Bucket& b, float& energy_per_meter, float& idle_power) const {
+        float w = options_.prior_weight * options_.prior_weight;
+        float a11 = b.dd + w, a12 = b.dt, a22 = b.tt + w;
+        float r1 = b.de + w * options_.prior_energy_per_meter;
+        float r2 = b.te + w * options_.prior_idle_power;
+        float det = a11 * a22 - a12 * a12;
+        energy_per_meter = (r1 * a22 - r2 * a12) / det;
+        idle_power = (r2 * a11 - r1 * a12) / det;
+        if (energy_per_meter < 0.0f) {
+            energy_per_meter = 0.0f;
+        }
+        if (idle_power < 0.0f) {
+            idle_power = 0.0f;
+        }
+    }
+
+    EnergyModelOptions options_;
+    Bucket buckets_[BUCKET_COUNT];
+    bool has_sample_;
+    int bucket_;
+    double last_time_;
+    float last_power_;
+    float last_mileage_;
+    float window_energy_;
+    float window_distance_;
+    float window_time_;
+    float percent_energy_;
+    uint8_t percent_mark_;
+    bool percent_aligned_;
+    float percent_sum_;
+    float percent_count_;
+};
+
+/**
+ * 计算路径折线长度
+ * @param path 路径
+ * @return 长度 (米)
+ */
+inline float pathLength(const NavigationPath& path) {
+    float length = 0.0f;
+    for (size_t i = 1; i < path.points.size(); ++i) {
+        const Point3D& a = path.points[i - 1].position;
+        const Point3D& b = path.points[i].position;
+        length += std::sqrt((b.x - a.x) * (b.x - a.x) + (b.y - a.y) * (b.y - a.y) +
+                            (b.z - a.z) * (b.z - a.z));
+    }
+    return length;
+}
+
+/**
+ * 由导航点目标队列构建任务能耗需求
+ * 距离取路网最短路线代价，停留时间累加WAIT目标的dwell_time
+ * @param graph 导航点路网
+ * @param start_point_id 起点导航点ID
+ * @param goals 目标队列 (仅支持WAY_POINT类型)
+ * @param dock_point_id 充电桩附近的导航点ID
+ * @param gait 执行任务的步态
+ * @param speed_level 执行任务的速度档位
+ * @param mission [out] 任务能耗需求
+ * @return true表示构建成功，含POSE目标或存在不可达目标时返回false
+ */
+inline bool buildMission(const WaypointGraph& graph, int32_t start_point_id,
+                         const std::vector<NavigationGoal>& goals, int32_t dock_point_id,
+                         GaitType gait, SpeedLevel speed_level, EnergyMission& mission) {
+    mission = EnergyMission();
+    mission.gait = gait;
+    mission.speed_level = speed_level;
+    int32_t current = start_point_id;
+    for (size_t i = 0; i < goals.size(); ++i) {
+        if (goals[i].type != NavigationGoalType::WAY_POINT) {
+            return false;
+        }
+        int32_t next = static_cast<int32_t>(goals[i].point_id);
+        float cost = graph.getRouteCost(current, next);
+        if (cost < 0.0f) {
+            return false;
+        }
+        mission.distance += cost;
+        if (goals[i].dwell_action == GoalDwellAction::WAIT && goals[i].dwell_time > 0.0f) {
+            mission.dwell_time += goals[i].dwell_time;
+        }
+        current = next;
+    }
+    mission.return_distance = graph.getRouteCost(current, dock_point_id);
+    return mission.return_distance >= 0.0f;
+}
+
+} // namespace q25
+} // namespace robot
+
+#endif // QUADRUPED_SDK_CHARGING_ENERGY_MODEL_HPP
@@ -0,0 +1,37 @@
+#ifndef QUADRUPED_SDK_COMMON_MATH_HPP
+#define QUADRUPED_SDK_COMMON_MATH_HPP
+
+#include "types.hpp"
+#include <cmath>
+
+namespace robot {
+namespace q25 {
+namespace detail {
+
+/**
+ * 四元数归一化线性插值 (取最短路径)
+ * @param a 起始姿态
+ * @param b 终止姿态
+ * @param t 插值系数 (0-1)
+ * @return 归一化后的插值姿态
+ */
+inline Quaternion nlerp(const Quaternion& a, const Quaternion& b, float t) {
+    float dot = a.x * b.x + a.y * b.y + a.z * b.z + a.w * b.w;
+    float s = dot < 0.0f ? -1.0f : 1.0f;
+    Quaternion q;
+    q.x = a.x + (s * b.x - a.x) * t;
+    q.y = a.y + (s * b.y - a.y) * t;
+    q.z = a.z + (s * b.z - a.z) * t;
+    q.w = a.w + (s * b.w - a.w) * t;
+    float n = std::sqrt(q.x * q.x + q.y * q.y + q.z * q.z + q.w * q.w);
+    if (n > 0.0f) {
+        q.x /= n; q.y /= n; q.z /= n; q.w /= n;
+    }
+    return q;
+}
+
+} // namespace detail
+} // namespace q25
+} // namespace robot
+
+#endif // QUADRUPED_SDK_COMMON_MATH_HPP
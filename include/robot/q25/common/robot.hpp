@@ -1,8 +1,14 @@
 #ifndef QUADRUPED_SDK_CORE_ROBOT_HPP
 #define QUADRUPED_SDK_CORE_ROBOT_HPP
 
+#include <cstdint>
+#include <functional>
+#include <future>
 #include <string>
 #include <memory>
+#include <vector>
+#include "robot_context.hpp"
+#include "types.hpp"
 
 namespace robot {
 namespace q25 {
@@ -10,9 +16,100 @@ namespace q25 {
 // 前向声明
 class RobotImpl;
 
+/**
+ * 连接状态
+ */
+enum class ConnectionState {
+    DISCONNECTED = 0,   // 未连接
+    CONNECTING = 1,     // 连接中
+    CONNECTED = 2,      // 已连接
+    RECONNECTING = 3    // 链路断开，自动重连中
+};
+
+/**
+ * 自动重连策略
+ * 重连间隔按指数退避增长: delay = min(initial_delay_ms * multiplier^n, max_delay_ms)
+ * 实际间隔在 [delay * (1 - jitter), delay] 内随机取值，避免多台机器人同时重连
+ */
+struct ReconnectPolicy {
+    bool enabled = true;                // 是否启用自动重连
+    uint32_t initial_delay_ms = 200;    // 首次重连间隔 (毫秒)
+    uint32_t max_delay_ms = 10000;      // 最大重连间隔 (毫秒)
+    float multiplier = 2.0f;            // 退避倍数
+    float jitter = 0.5f;                // 随机抖动比例 (0-1)
+    uint32_t max_attempts = 0;          // 最大重连次数，0表示不限
+};
+
+/**
+ * 遥测订阅描述
+ * 由机器人端执行降频与字段裁剪，只下发客户端需要的字段
+ */
+struct TelemetrySubscription {
+    TelemetryTopic topic;       // 遥测主题
+    float rate_hz;              // 期望下发频率 (Hz)，<=0 表示源频率
+    uint32_t decimation;        // 降采样因子 (每N帧下发1帧)，0或1表示不降采样
+    uint64_t field_mask;        // 字段掩码，0表示全部字段 (位定义见各主题的*_FIELD_*常量)
+};
+
+// BatteryState 字段掩码
+constexpr uint64_t BATTERY_FIELD_PERCENTAGE = 1ULL << 0;
+constexpr uint64_t BATTERY_FIELD_IS_CHARGING = 1ULL << 1;
+
+// MotionState 字段掩码
+constexpr uint64_t MOTION_FIELD_BASIC_STATE = 1ULL << 0;
+constexpr uint64_t MOTION_FIELD_MOTION_MODE = 1ULL << 1;
+constexpr uint64_t MOTION_FIELD_GAIT = 1ULL << 2;
+constexpr uint64_t MOTION_FIELD_SPEED_LEVEL = 1ULL << 3;
+constexpr uint64_t MOTION_FIELD_VELOCITY = 1ULL << 4;
+constexpr uint64_t MOTION_FIELD_POSE = 1ULL << 5;
+constexpr uint64_t MOTION_FIELD_BODY = 1ULL << 6;   // body_height/body_roll/body_pitch
+
+// IMUData 字段掩码
+constexpr uint64_t IMU_FIELD_ORIENTATION = 1ULL << 0;
+constexpr uint64_t IMU_FIELD_ANGULAR_VELOCITY = 1ULL << 1;
+constexpr uint64_t IMU_FIELD_ACCELERATION = 1ULL << 2;
+
+// AllJointsData 字段掩码
+constexpr uint64_t JOINT_FIELD_POSITION = 1ULL << 0;
+constexpr uint64_t JOINT_FIELD_VELOCITY = 1ULL << 1;
+constexpr uint64_t JOINT_FIELD_TORQUE = 1ULL << 2;
+constexpr uint64_t JOINT_FIELD_TEMPERATURE = 1ULL << 3;  // motor_temp/driver_temp
+constexpr uint64_t JOINT_FIELD_ERROR_CODE = 1ULL << 4;
+
+/**
+ * 优先命令通道配置
+ * 运动与安全命令 (急停、轴控制、停止等) 使用独立套接字发送，
+ * 在I/O线程中严格优先于地图下载、场景/轨迹刷新、LiDAR等批量传输处理，不会排在批量数据之后
+ */
+struct CommandChannelOptions {
+    bool enabled = true;            // 是否启用独立命令通道 (关闭时与其他数据共用链路)
+    uint8_t dscp = 46;              // IP DSCP标记 (46=EF，对应Wi-Fi WMM语音队列)
+    uint32_t ack_timeout_ms = 20;   // 确认超时 (毫秒)，超时后按原序号重发
+    uint32_t max_retries = 3;       // 最大重发次数
+};
+
+/**
+ * 优先命令通道统计
+ */
+struct CommandChannelStats {
+    uint64_t sent;                  // 已发送命令数
+    uint64_t acked;                 // 已确认命令数
+    uint64_t retransmits;           // 重发次数
+    uint64_t dropped;               // 超过重发次数仍未确认的命令数
+    float last_rtt_ms;              // 最近一次往返时延 (毫秒)
+    float avg_rtt_ms;               // 平均往返时延 (毫秒)
+};
+
+// 连接状态变化事件回调类型
+using ConnectionStateCallback = std::function<void(ConnectionState)>;
+
+// 连接结果回调类型
+using ConnectCallback = std::function<void(bool)>;
+
 /**
  * Robot - 机器人SDK入口类
  * 提供连接管理和各功能模块的访问接口
+ * 各功能模块通过构造参数绑定到指定Robot，一个进程可同时控制多台机器人
  */
 class Robot {
 public:
@@ -22,15 +119,36 @@ public:
      */
     explicit Robot(const std::string& robot_ip);
 
+    /**
+     * 构造函数，使用指定的共享运行时
+     * 多台机器人共享同一RobotContext时，所有连接共用一个I/O事件循环和工作线程池
+     * @param robot_ip 机器人IP地址
+     * @param context 共享运行时
+     */
+    Robot(const std::string& robot_ip, std::shared_ptr<RobotContext> context);
+
     ~Robot();
 
     // ============ 连接管理 ============
 
     /**
      * 连接到机器人
+     * 阻塞直至连接成功或超时，失败时抛出ConnectionException
      */
     void connect();
 
+    /**
+     * 异步连接到机器人 (不阻塞)
+     * @return 连接结果，true表示连接成功
+     */
+    std::future<bool> connectAsync();
+
+    /**
+     * 异步连接到机器人 (不阻塞)
+     * @param callback 连接完成回调（参数表示成功/失败）
+     */
+    void connectAsync(ConnectCallback callback);
+
     /**
      * 断开与机器人的连接
      */
@@ -42,6 +160,83 @@ public:
      */
     bool isConnected() const;
 
+    /**
+     * 获取连接状态
+     * @return 当前连接状态
+     */
+    ConnectionState getConnectionState() const;
+
+    /**
+     * 订阅连接状态变化事件
+     * 链路断开时状态变为RECONNECTING，期间各模块调用立即失败
+     * (返回false或抛出ConnectionException)，不会阻塞等待连接超时
+     * @param callback 事件回调函数
+     */
+    void subscribeConnectionState(ConnectionStateCallback callback);
+
+    /**
+     * 设置自动重连策略
+     * 在connect()/connectAsync()之前或之后设置均可，对下一次断线生效
+     * @param policy 重连策略
+     */
+    void setReconnectPolicy(const ReconnectPolicy& policy);
+
+    /**
+     * 获取此机器人使用的共享运行时
+     * @return 运行时
+     */
+    std::shared_ptr<RobotContext> getContext() const;
+
+    // ============ 优先命令通道 ============
+
+    /**
+     * 设置优先命令通道参数
+     * 需在connect()之前调用
+     * @param options 通道参数
+     */
+    void setCommandChannelOptions(const CommandChannelOptions& options);
+
+    /**
+     * 获取优先命令通道统计
+     * @return 统计信息
+     */
+    CommandChannelStats getCommandChannelStats() const;
+
+    // ============ 遥测订阅 ============
+
+    /**
+     * 设置遥测订阅
+     * 订阅在机器人端生效，未订阅的主题不再下发，已订阅主题按频率和字段掩码裁剪
+     * 各模块的getter返回最近一次收到的数据，被裁剪的字段保持上次的值
+     * 未调用时机器人按默认全字段、源频率下发
+     * @param subscriptions 订阅描述列表 (覆盖之前的订阅)
+     * @return true表示机器人已接受订阅
+     */
+    bool setTelemetrySubscriptions(const std::vector<TelemetrySubscription>& subscriptions);
+
+    /**
+     * 获取当前生效的遥测订阅
+     * @return 订阅描述列表，机器人端按能力调整后的实际频率会反映在rate_hz中
+     */
+    std::vector<TelemetrySubscription> getTelemetrySubscriptions() const;
+
+    // ============ 外部事件循环 ============
+
+    /**
+     * 获取事件文件描述符 (仅RobotContext为EXTERNAL模式时有效)
+     * 等价于getContext()->getEventFd()
+     * @return 文件描述符，INTERNAL模式返回-1
+     */
+    int getEventFd() const;
+
+    /**
+     * 在调用线程上处理就绪事件 (仅RobotContext为EXTERNAL模式时有效)
+     * 等价于getContext()->processEvents(budget)，共享运行时的其他Robot的事件一并处理
+     * @param budget 本次最多处理的事件数，0表示处理全部就绪事件
+     * @return 实际处理的事件数
+     */
+    uint32_t processEvents(uint32_t budget = 0);
+
 private:
     std::unique_ptr<RobotImpl> pImpl;
 
@@ -0,0 +1,97 @@
+#ifndef QUADRUPED_SDK_CORE_ROBOT_CONTEXT_HPP
+#define QUADRUPED_SDK_CORE_ROBOT_CONTEXT_HPP
+
+#include <cstdint>
+
+namespace robot {
+namespace q25 {
+
+/**
+ * 事件循环模式
+ */
+enum class EventLoopMode {
+    INTERNAL = 0,   // SDK内部I/O线程和工作线程池执行事件循环与回调
+    EXTERNAL = 1    // 不创建内部线程，由调用方在自己的事件循环中驱动
+};
+
+/**
+ * RobotContext - SDK共享运行时
+ * 持有一个I/O事件循环线程 (epoll) 和一个回调工作线程池
+ * 同一进程内的多个Robot可共享同一个RobotContext，线程数不随机器人数量增长
+ * 未显式指定时，Robot使用进程级默认RobotContext
+ *
+ * 事件循环 (reactor) 说明:
+ *   - 所有模块的UDP/TCP套接字均注册到同一个epoll实例，由单个I/O线程收发
+ *   - 命令超时与重发、状态查询周期由timerfd驱动，不使用sleep轮询
+ *   - 其他线程发起的请求通过eventfd唤醒I/O线程
+ *   - 收到的报文在I/O线程解码后分发给对应模块，用户回调在工作线程池中执行
+ */
+class RobotContext {
+public:
+    /**
+     * 构造函数
+     * @param worker_threads 回调工作线程数量，0表示使用硬件线程数
+     */
+    explicit RobotContext(uint32_t worker_threads = 0);
+
+    /**
+     * 构造函数，指定事件循环模式
+     * EXTERNAL模式下SDK不创建任何内部线程，所有I/O处理和回调
+     * (subscribeRecordingEvent、subscribeSceneUpdate、下载回调等)
+     * 均在调用processEvents()的线程上执行，无需跨线程投递和加锁
+     * @param mode 事件循环模式
+     */
+    explicit RobotContext(EventLoopMode mode);
+
+    ~RobotContext();
+
+    // 禁用复制
+    RobotContext(const RobotContext&) = delete;
+    RobotContext& operator=(const RobotContext&) = delete;
+
+    /**
+     * 获取使用此运行时的Robot数量
+     * @return Robot数量
+     */
+    uint32_t getRobotCount() const;
+
+    /**
+     * 获取回调工作线程数量
+     * @return 线程数量
+     */
+    uint32_t getWorkerThreadCount() const;
+
+    /**
+     * 获取事件循环模式
+     * @return 事件循环模式
+     */
+    EventLoopMode getEventLoopMode() const;
+
+    // ============ 外部事件循环 ============
+
+    /**
+     * 获取事件文件描述符 (仅EXTERNAL模式)
+     * 这是宿主程序唯一需要监听的描述符：可读时调用processEvents()，
+     * 可直接注册到asio/libuv等事件循环；该描述符仅用于监听，不得对其读写或关闭
+     * INTERNAL模式下事件由SDK内部I/O线程处理，不对外暴露描述符
+     * @return 文件描述符，INTERNAL模式返回-1
+     */
+    int getEventFd() const;
+
+    /**
+     * 在调用线程上处理就绪事件 (仅EXTERNAL模式)
+     * 不阻塞，无就绪事件时立即返回
+     * @param budget 本次最多处理的事件数，0表示处理全部就绪事件
+     * @return 实际处理的事件数
+     */
+    uint32_t processEvents(uint32_t budget = 0);
+
+private:
+    struct Impl;
+    Impl* impl_;
+};
+
+} // namespace q25
+} // namespace robot
+
+#endif // QUADRUPED_SDK_CORE_ROBOT_CONTEXT_HPP
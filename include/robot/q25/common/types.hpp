@@ -1,6 +1,7 @@
 #ifndef QUADRUPED_SDK_CORE_TYPES_HPP
 #define QUADRUPED_SDK_CORE_TYPES_HPP
 
+#include <array>
 #include <cstdint>
 #include <functional>
 #include <string>
@@ -109,6 +110,18 @@ enum class NavigationStatus {
     FAILED = 4
 };
 
+// 导航进度
+struct NavigationProgress {
+    NavigationMode mode;           // 导航模式 (定点/循迹)
+    NavigationStatus status;       // 导航状态
+    uint32_t target_id;            // 目标点ID (定点) 或路径ID (循迹)
+    int32_t current_waypoint;      // 当前路径点/队列目标索引，无效时为-1
+    uint32_t total_waypoints;      // 路径点/队列目标总数
+    float distance_remaining;      // 剩余距离 (米)，未知时为-1
+    float eta;                     // 预计剩余时间 (秒)，未知时为-1
+    double timestamp;              // 时间戳
+};
+
 // 错误代码
 enum class ErrorCode {
     SUCCESS = 0,
@@ -119,6 +132,21 @@ enum class ErrorCode {
     TIMEOUT = 5
 };
 
+// 遥测主题
+enum class TelemetryTopic {
+    UNKNOWN = 0,
+    LIDAR_SCAN = 1,     // LiDARScan
+    ALL_JOINTS = 2,     // AllJointsData
+    IMU = 3,            // IMUData
+    MOTION_STATE = 4,   // MotionState
+    BATTERY = 5         // BatteryState (仅用于订阅，无紧凑编码)
+};
+
+// 遥测话题数量 (新增话题时同步修改)
+constexpr uint32_t TELEMETRY_TOPIC_COUNT = 6;
+static_assert(static_cast<uint32_t>(TelemetryTopic::BATTERY) + 1 == TELEMETRY_TOPIC_COUNT,
+              "TELEMETRY_TOPIC_COUNT must match TelemetryTopic");
+
 // IMU 数据
 struct IMUData {
     double timestamp;
@@ -180,6 +208,44 @@ enum class MappingCommand {
     FINISH = 2    // 结束建图
 };
 
+// 地图保存阶段
+enum class MapSaveStage {
+    IDLE = 0,         // 未在保存
+    OPTIMIZING = 1,   // 全局位姿优化
+    GENERATING = 2,   // 生成点云与栅格地图
+    WRITING = 3,      // 写入地图文件
+    INDEXING = 4,     // 生成全局位置索引
+    DONE = 5,         // 保存完成
+    CANCELLED = 6,    // 已取消
+    FAILED = 7        // 保存失败
+};
+
+// 地图保存进度
+struct MapSaveProgress {
+    MapSaveStage stage;   // 当前阶段
+    float percent;        // 总体进度 (0-100)
+    float eta;            // 预计剩余时间 (秒)，未知时为-1
+    double timestamp;     // 时间戳
+};
+
+// 局部地图更新区域 (地图坐标系轴对齐矩形)
+struct MapUpdateRegion {
+    float min_x;    // 区域最小x (米)
+    float min_y;    // 区域最小y (米)
+    float max_x;    // 区域最大x (米)
+    float max_y;    // 区域最大y (米)
+};
+
+// 局部地图更新结果
+struct MapUpdateSummary {
+    uint32_t sub_scene_id;      // 被更新的子场景ID
+    uint32_t updated_submaps;   // 重建并合并的子图数量
+    uint32_t pixel_x;           // 栅格地图中发生变化的区域左上角列 (像素)
+    uint32_t pixel_y;           // 栅格地图中发生变化的区域左上角行 (像素)
+    uint32_t pixel_width;       // 变化区域宽度 (像素)，无变化时为0
+    uint32_t pixel_height;      // 变化区域高度 (像素)，无变化时为0
+};
+
 // 建图路径点
 struct MappingPathPoint {
     double x;
@@ -187,6 +253,17 @@ struct MappingPathPoint {
     double z;
 };
 
+// 建图预览 (降采样占据栅格)
+struct MappingPreview {
+    double timestamp;           // 时间戳
+    float resolution;           // 栅格分辨率 (米/格)
+    float origin_x;             // 栅格左下角x坐标 (米)
+    float origin_y;             // 栅格左下角y坐标 (米)
+    uint32_t width;             // 栅格宽度 (格)
+    uint32_t height;            // 栅格高度 (格)
+    std::vector<int8_t> cells;  // 行优先占据栅格，-1=未知，0-100=占据概率
+};
+
 // 定位信息
 struct LocalizationInfo {
     float position_x;
@@ -199,6 +276,15 @@ struct LocalizationInfo {
     float laser_quality;  // 激光定位质量
 };
 
+// 定位更新 (定位器每次输出一帧)
+struct LocalizationUpdate {
+    double timestamp;                   // 时间戳 (秒，机器人时钟)
+    Pose pose;                          // 地图坐标系下的位姿
+    std::array<float, 36> covariance;   // 位姿协方差 (x y z roll pitch yaw，行优先6×6)
+    float laser_quality;                // 激光定位质量
+    float match_ratio;                  // 点云匹配内点比例 (0-1)
+};
+
 // ============ 轨迹录制相关类型 ============
 
 // 轨迹录制命令
@@ -253,9 +339,27 @@ struct NavigationTrajectory {
 // 轨迹录制事件回调类型
 using RecordingEventCallback = std::function<void(RecordResult)>;
 
+// 定位更新事件回调类型
+using LocalizationCallback = std::function<void(LocalizationUpdate)>;
+
+// 地图保存进度事件回调类型
+using MapSaveProgressCallback = std::function<void(MapSaveProgress)>;
+
+// 建图路径点增量事件回调类型 (参数为新增的路径点)
+using MappingPathCallback = std::function<void(std::vector<MappingPathPoint>)>;
+
+// 建图预览事件回调类型
+using MappingPreviewCallback = std::function<void(MappingPreview)>;
+
 // 场景更新事件回调类型
 using SceneUpdateCallback = std::function<void(std::vector<SceneDetail>)>;
 
+// 导航状态变化事件回调类型
+using NavigationStatusCallback = std::function<void(NavigationStatus)>;
+
+// 导航进度事件回调类型
+using NavigationProgressCallback = std::function<void(NavigationProgress)>;
+
 // 导航轨迹更新事件回调类型
 using NavigationTrajectoryUpdateCallback = std::function<void(std::vector<NavigationTrajectory>)>;
 
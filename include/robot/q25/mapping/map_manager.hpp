@@ -8,13 +8,26 @@
 namespace robot {
 namespace q25 {
 
+// 前向声明
+class Robot;
+
 /**
  * MapManager - 地图与导航轨迹管理接口
  * 提供场景、地图、导航轨迹的管理功能
  */
 class MapManager {
 public:
+    /**
+     * 构造函数，绑定到默认机器人实例 (进程内首个创建的Robot)
+     */
     MapManager();
+
+    /**
+     * 构造函数，绑定到指定机器人实例
+     * 同一进程可为多个Robot分别创建模块对象
+     * @param robot 机器人实例 (生命周期须长于本对象)
+     */
+    explicit MapManager(Robot& robot);
     ~MapManager();
 
     // 禁用复制
@@ -81,6 +94,24 @@ public:
                      const std::string& save_dir,
                      std::function<void(bool)> callback);
 
+    /**
+     * 下载地图并保存为分块压缩容器 (见tiled_map.hpp)
+     * 下载YAM和PGM后在本地切分压缩，完成后删除临时的PGM文件
+     * 之后可用TiledMapReader按区域读取，无需加载整张地图
+     * 注意: 机器人端不支持按瓦片下发，传输量与downloadMap()相同，
+     * 分块只减少本地存储与之后按区域读取的开销
+     * @param scene_name 场景名称
+     * @param sub_scene_id 子场景ID
+     * @param save_path 分块地图保存路径（绝对路径）
+     * @param tile_size 瓦片边长（像素）
+     * @param callback 完成回调（参数表示成功/失败）
+     */
+    void downloadTiledMap(const std::string& scene_name,
+                          uint32_t sub_scene_id,
+                          const std::string& save_path,
+                          uint32_t tile_size,
+                          std::function<void(bool)> callback);
+
     // ============ 导航轨迹管理 ============
 
 	/**
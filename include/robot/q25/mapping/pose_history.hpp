@@ -0,0 +1,192 @@
+#ifndef QUADRUPED_SDK_MAPPING_POSE_HISTORY_HPP
+#define QUADRUPED_SDK_MAPPING_POSE_HISTORY_HPP
+
+#include "../common/math.hpp"
+#include "../common/types.hpp"
+#include <atomic>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+
+namespace robot {
+namespace q25 {
+
+/**
+ * PoseHistory - 定位历史环形缓冲区
+ * 单写者、多读者无锁结构：写者为定位事件回调，读者可在任意线程查询
+ * 每个槽位带序号 (seqlock)，读者发现槽位正在被覆盖时自动重试
+ * 纯本地计算，不依赖机器人连接
+ */
+class PoseHistory {
+public:
+    /**
+     * 构造函数
+     * @param capacity 历史容量 (帧)，实际容量不小于该值
+     */
+    explicit PoseHistory(size_t capacity = 1024)
+        : mask_(roundUp(capacity) - 1), slots_(new Slot[mask_ + 1]), count_(0) {}
+
+    // 禁用复制
+    PoseHistory(const PoseHistory&) = delete;
+    PoseHistory& operator=(const PoseHistory&) = delete;
+
+    /**
+     * 追加一帧定位更新 (仅允许单个线程调用)
+     * 时间戳须单调递增，否则该帧被丢弃
+     * @param update 定位更新
+     */
+    void push(const LocalizationUpdate& update) {
+        uint64_t index = count_.load(std::memory_order_relaxed);
+        if (index > 0) {
+            const Slot& prev = slots_[(index - 1) & mask_];
+            if (!(update.timestamp > prev.data.timestamp)) {
+                return;
+            }
+        }
+        Slot& slot = slots_[index & mask_];
+        slot.seq.store(index * 2 + 1, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_release);
+        std::memcpy(&slot.data, &update, sizeof(update));
+        slot.seq.store(index * 2 + 2, std::memory_order_release);
+        count_.store(index + 1, std::memory_order_release);
+    }
+
+    /**
+     * 获取最新一帧
+     * @param update [out] 定位更新
+     * @return true表示获取成功，历史为空时返回false
+     */
+    bool latest(LocalizationUpdate& update) const {
+        for (;;) {
+            uint64_t count = count_.load(std::memory_order_acquire);
+            if (count == 0) {
+                return false;
+            }
+            if (read(count - 1, update)) {
+                return true;
+            }
+        }
+    }
+
+    /**
+     * 获取指定时刻的位姿 (相邻两帧之间线性插值，姿态归一化插值)
+     * 不做外推，时间戳超出历史范围时返回false
+     * @param timestamp 查询时刻 (秒，机器人时钟)
+     * @param update [out] 插值结果，协方差与质量取两帧的线性插值
+     * @return true表示查询成功
+     */
+    bool interpolate(double timestamp, LocalizationUpdate& update) const {
+        for (int attempt = 0; attempt < 4; ++attempt) {
+            uint64_t count = count_.load(std::memory_order_acquire);
+            if (count == 0) {
+                return false;
+            }
+            // 最旧的槽位可能正被写者覆盖，留出一个槽位余量
+            uint64_t lo = count > mask_ ? count - mask_ : 0;
+            uint64_t hi = count - 1;
+
+            LocalizationUpdate first;
+            LocalizationUpdate last;
+            if (!read(lo, first) || !read(hi, last)) {
+                continue;
+            }
+            if (timestamp < first.timestamp || timestamp > last.timestamp) {
+                return false;
+            }
+            if (timestamp == last.timestamp) {
+                update = last;
+                return true;
+            }
+
+            // 二分查找 first.timestamp <= timestamp < next.timestamp
+            LocalizationUpdate before = first;
+            LocalizationUpdate after = last;
+            bool ok = true;
+            while (hi - lo > 1) {
+                uint64_t mid = lo + (hi - lo) / 2;
+                LocalizationUpdate probe;
+                if (!read(mid, probe)) {
+                    ok = false;
+                    break;
+                }
+                if (probe.timestamp <= timestamp) {
+                    lo = mid;
+                    before = probe;
+                } else {
+                    hi = mid;
+                    after = probe;
+                }
+            }
+            if (!ok) {
+                continue;
+            }
+            blend(before, after, timestamp, update);
+            return true;
+        }
+        return false;
+    }
+
+    /**
+     * 获取当前保存的帧数
+     */
+    size_t size() const {
+        uint64_t count = count_.load(std::memory_order_acquire);
+        return static_cast<size_t>(count < mask_ ? count : mask_);
+    }
+
+    /**
+     * 获取容量
+     */
+    size_t capacity() const { return static_cast<size_t>(mask_); }
+
+private:
+    struct Slot {
+        Slot() : seq(0) {}
+        std::atomic<uint64_t> seq;
+        LocalizationUpdate data;
+    };
+
+    static size_t roundUp(size_t capacity) {
+        size_t n = 2;
+        while (n < capacity + 1) {
+            n <<= 1;
+        }
+        return n;
+    }
+
+    bool read(uint64_t index, LocalizationUpdate& update) const {
+        const Slot& slot = slots_[index & mask_];
+        uint64_t expected = index * 2 + 2;
+        if (slot.seq.load(std::memory_order_acquire) != expected) {
+            return false;
+        }
+        std::memcpy(&update, &slot.data, sizeof(update));
+        std::atomic_thread_fence(std::memory_order_acquire);
+        return slot.seq.load(std::memory_order_relaxed) == expected;
+    }
+
+    static void blend(const LocalizationUpdate& a, const LocalizationUpdate& b,
+                      double timestamp, LocalizationUpdate& out) {
+        double span = b.timestamp - a.timestamp;
+        float t = span > 0.0 ? static_cast<float>((timestamp - a.timestamp) / span) : 0.0f;
+        out.timestamp = timestamp;
+        out.pose.position.x = a.pose.position.x + (b.pose.position.x - a.pose.position.x) * t;
+        out.pose.position.y = a.pose.position.y + (b.pose.position.y - a.pose.position.y) * t;
+        out.pose.position.z = a.pose.position.z + (b.pose.position.z - a.pose.position.z) * t;
+        out.pose.orientation = detail::nlerp(a.pose.orientation, b.pose.orientation, t);
+        for (size_t i = 0; i < out.covariance.size(); ++i) {
+            out.covariance[i] = a.covariance[i] + (b.covariance[i] - a.covariance[i]) * t;
+        }
+        out.laser_quality = a.laser_quality + (b.laser_quality - a.laser_quality) * t;
+        out.match_ratio = a.match_ratio + (b.match_ratio - a.match_ratio) * t;
+    }
+
+    const uint64_t mask_;
+    std::unique_ptr<Slot[]> slots_;
+    std::atomic<uint64_t> count_;
+};
+
+} // namespace q25
+} // namespace robot
+
+#endif // QUADRUPED_SDK_MAPPING_POSE_HISTORY_HPP
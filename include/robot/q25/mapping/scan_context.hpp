@@ -0,0 +1,290 @@
+#ifndef QUADRUPED_SDK_MAPPING_SCAN_CONTEXT_HPP
+#define QUADRUPED_SDK_MAPPING_SCAN_CONTEXT_HPP
+
+#include "../common/types.hpp"
+#include "../sensor/lidar.hpp"
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+namespace robot {
+namespace q25 {
+
+/**
+ * Scan Context 描述子参数
+ */
+struct ScanContextOptions {
+    uint32_t rings = 20;            // 径向环数
+    uint32_t sectors = 60;          // 方位扇区数
+    float max_range = 80.0f;        // 最大统计距离 (米)
+    float height_offset = 2.0f;     // 高度偏移 (米)，使地面附近的点高度为正
+};
+
+/**
+ * ScanContext - 单帧点云的全局位置描述子
+ * 将点云按极坐标划分为 rings × sectors 个格子，每格取最大高度
+ * 环键 (每环均值) 与旋转无关，用于快速检索；完整描述子用于按列平移比对并估计偏航角
+ * 纯本地计算，不依赖机器人连接
+ */
+class ScanContext {
+public:
+    ScanContext() : rings_(0), sectors_(0) {}
+
+    /**
+     * 由点云计算描述子
+     * @param scan LiDAR扫描 (传感器坐标系)
+     * @param options 描述子参数
+     */
+    explicit ScanContext(const LiDARScan& scan,
+                         const ScanContextOptions& options = ScanContextOptions()) {
+        compute(scan, options);
+    }
+
+    /**
+     * 由点云计算描述子
+     * @param scan LiDAR扫描 (传感器坐标系)
+     * @param options 描述子参数
+     */
+    void compute(const LiDARScan& scan, const ScanContextOptions& options = ScanContextOptions()) {
+        rings_ = options.rings;
+        sectors_ = options.sectors;
+        descriptor_.assign(static_cast<size_t>(rings_) * sectors_, 0.0f);
+        ring_key_.assign(rings_, 0.0f);
+        if (rings_ == 0 || sectors_ == 0) {
+            return;
+        }
+
+        const float two_pi = 6.28318530718f;
+        for (size_t i = 0; i < scan.points.size(); ++i) {
+            const LiDARPoint& p = scan.points[i];
+            float range = std::sqrt(p.x * p.x + p.y * p.y);
+            if (range <= 0.0f || range >= options.max_range) {
+                continue;
+            }
+            float angle = std::atan2(p.y, p.x);
+            if (angle < 0.0f) {
+                angle += two_pi;
+            }
+            uint32_t ring = std::min(static_cast<uint32_t>(range / options.max_range * rings_), rings_ - 1);
+            uint32_t sector = std::min(static_cast<uint32_t>(angle / two_pi * sectors_), sectors_ - 1);
+            float& cell = descriptor_[ring * sectors_ + sector];
+            cell = std::max(cell, p.z + options.height_offset);
+        }
+
+        for (uint32_t r = 0; r < rings_; ++r) {
+            float sum = 0.0f;
+            for (uint32_t s = 0; s < sectors_; ++s) {
+                sum += descriptor_[r * sectors_ + s];
+            }
+            ring_key_[r] = sum / sectors_;
+        }
+    }
+
+    /**
+     * 计算与另一描述子的距离
+     * 遍历所有扇区平移取最小值，距离范围 [0, 1]，越小越相似
+     * @param other 另一描述子 (参数须相同)
+     * @param yaw_offset [out] 本帧相对other的偏航角 (弧度)
+     * @return 描述子距离，参数不一致时返回1
+     */
+    float distance(const ScanContext& other, float& yaw_offset) const {
+        yaw_offset = 0.0f;
+        if (rings_ != other.rings_ || sectors_ != other.sectors_ || sectors_ == 0) {
+            return 1.0f;
+        }
+        float best = std::numeric_limits<float>::max();
+        uint32_t best_shift = 0;
+        for (uint32_t shift = 0; shift < sectors_; ++shift) {
+            float sum = 0.0f;
+            uint32_t valid = 0;
+            for (uint32_t s = 0; s < sectors_; ++s) {
+                uint32_t t = (s + shift) % sectors_;
+                float dot = 0.0f, na = 0.0f, nb = 0.0f;
+                for (uint32_t r = 0; r < rings_; ++r) {
+                    float a = descriptor_[r * sectors_ + s];
+                    float b = other.descriptor_[r * sectors_ + t];
+                    dot += a * b;
+                    na += a * a;
+                    nb += b * b;
+                }
+                if (na > 0.0f && nb > 0.0f) {
+                    sum += 1.0f - dot / std::sqrt(na * nb);
+                    ++valid;
+                }
+            }
+            float d = valid > 0 ? sum / valid : 1.0f;
+            if (d < best) {
+                best = d;
+                best_shift = shift;
+            }
+        }
+        // 本帧第s列对应other第s+shift列，即本帧相对other逆时针转过shift个扇区
+        float sector_angle = 6.28318530718f / sectors_;
+        yaw_offset = best_shift * sector_angle;
+        if (yaw_offset > 3.14159265359f) {
+            yaw_offset -= 6.28318530718f;
+        }
+        return best;
+    }
+
+    /**
+     * 获取环键 (与旋转无关)
+     */
+    const std::vector<float>& getRingKey() const { return ring_key_; }
+
+    /**
+     * 获取完整描述子 (行优先 rings × sectors)
+     */
+    const std::vector<float>& getDescriptor() const { return descriptor_; }
+
+    /**
+     * 检查描述子是否为空
+     */
+    bool empty() const { return descriptor_.empty(); }
+
+private:
+    uint32_t rings_;
+    uint32_t sectors_;
+    std::vector<float> descriptor_;
+    std::vector<float> ring_key_;
+};
+
+/**
+ * 位置检索结果
+ */
+struct PlaceMatch {
+    uint32_t place_id;      // 关键帧ID (按添加顺序从0编号)
+    Pose place_pose;        // 关键帧位姿
+    Pose estimated_pose;    // 按偏航角修正后的位姿估计，可作为重定位初始位姿
+    float distance;         // 描述子距离 (0-1，越小越相似)
+    float yaw_offset;       // 查询帧相对关键帧的偏航角 (弧度)
+};
+
+/**
+ * PlaceIndex - 场景全局位置索引
+ * 保存场景内各关键帧的ScanContext及其地图位姿，重定位时先用环键做最近邻筛选，
+ * 再对候选做完整描述子比对，得到位姿初值
+ * SDK不提供场景关键帧的下载接口，索引由应用自行构建，
+ * 例如在定位过程中按固定间距以LiDAR扫描与当前位姿添加关键帧；
+ * SLAM::relocalizeGlobal()使用机器人端的内部索引，与本类无关
+ * 纯本地计算，不依赖机器人连接
+ */
+class PlaceIndex {
+public:
+    PlaceIndex() : key_size_(0) {}
+
+    /**
+     * 添加关键帧
+     * 关键帧ID按添加顺序从0编号，即添加前的size()
+     * @param descriptor 关键帧描述子 (环数须与已添加的关键帧一致)
+     * @param pose 关键帧在地图中的位姿
+     * @return true表示添加成功，描述子为空或环数不一致时返回false
+     */
+    bool add(const ScanContext& descriptor, const Pose& pose) {
+        const std::vector<float>& key = descriptor.getRingKey();
+        if (key.empty() || (!places_.empty() && key.size() != key_size_)) {
+            return false;
+        }
+        key_size_ = key.size();
+        Place place;
+        place.descriptor = descriptor;
+        place.pose = pose;
+        places_.push_back(place);
+        // 环键连续存放，检索时顺序扫描
+        keys_.insert(keys_.end(), key.begin(), key.end());
+        return true;
+    }
+
+    /**
+     * 检索与查询帧最相似的关键帧
+     * @param descriptor 查询帧描述子
+     * @param num_candidates 环键筛选的候选数量
+     * @param max_results 返回的最大结果数量
+     * @return 按描述子距离升序排列的检索结果
+     */
+    std::vector<PlaceMatch> query(const ScanContext& descriptor,
+                                  uint32_t num_candidates = 10,
+                                  uint32_t max_results = 1) const {
+        std::vector<PlaceMatch> results;
+        const std::vector<float>& key = descriptor.getRingKey();
+        if (places_.empty() || key_size_ == 0 || key.size() != key_size_ || num_candidates == 0) {
+            return results;
+        }
+
+        std::vector<std::pair<float, uint32_t> > ranked(places_.size());
+        for (size_t i = 0; i < places_.size(); ++i) {
+            const float* k = &keys_[i * key_size_];
+            float d = 0.0f;
+            for (size_t j = 0; j < key_size_; ++j) {
+                float diff = k[j] - key[j];
+                d += diff * diff;
+            }
+            ranked[i] = std::make_pair(d, static_cast<uint32_t>(i));
+        }
+        size_t n = std::min<size_t>(num_candidates, ranked.size());
+        std::partial_sort(ranked.begin(), ranked.begin() + n, ranked.end());
+
+        for (size_t i = 0; i < n; ++i) {
+            const Place& place = places_[ranked[i].second];
+            PlaceMatch match;
+            match.place_id = ranked[i].second;
+            match.place_pose = place.pose;
+            match.distance = descriptor.distance(place.descriptor, match.yaw_offset);
+            match.estimated_pose = place.pose;
+            match.estimated_pose.orientation = rotateYaw(place.pose.orientation, match.yaw_offset);
+            results.push_back(match);
+        }
+        std::sort(results.begin(), results.end(), closer);
+        if (results.size() > max_results) {
+            results.resize(max_results);
+        }
+        return results;
+    }
+
+    /**
+     * 获取关键帧数量
+     */
+    size_t size() const { return places_.size(); }
+
+    /**
+     * 清空索引
+     */
+    void clear() {
+        places_.clear();
+        keys_.clear();
+        key_size_ = 0;
+    }
+
+private:
+    struct Place {
+        ScanContext descriptor;
+        Pose pose;
+    };
+
+    static bool closer(const PlaceMatch& a, const PlaceMatch& b) {
+        return a.distance < b.distance;
+    }
+
+    // 在机体坐标系下绕z轴旋转yaw
+    static Quaternion rotateYaw(const Quaternion& q, float yaw) {
+        float c = std::cos(yaw * 0.5f);
+        float s = std::sin(yaw * 0.5f);
+        Quaternion r;
+        r.w = q.w * c - q.z * s;
+        r.x = q.x * c + q.y * s;
+        r.y = q.y * c - q.x * s;
+        r.z = q.z * c + q.w * s;
+        return r;
+    }
+
+    size_t key_size_;
+    std::vector<Place> places_;
+    std::vector<float> keys_;
+};
+
+} // namespace q25
+} // namespace robot
+
+#endif // QUADRUPED_SDK_MAPPING_SCAN_CONTEXT_HPP
@@ -8,13 +8,26 @@
 namespace robot {
 namespace q25 {
 
+// 前向声明
+class Robot;
+
 /**
  * SLAM - 建图与定位接口
  * 提供SLAM建图、定位、轨迹录制功能
  */
 class SLAM {
 public:
+    /**
+     * 构造函数，绑定到默认机器人实例 (进程内首个创建的Robot)
+     */
     SLAM();
+
+    /**
+     * 构造函数，绑定到指定机器人实例
+     * 同一进程可为多个Robot分别创建模块对象
+     * @param robot 机器人实例 (生命周期须长于本对象)
+     */
+    explicit SLAM(Robot& robot);
     ~SLAM();
 
     // 禁用复制
@@ -25,6 +38,7 @@ public:
 
     /**
      * 开始建图
+     * 已有场景只有局部变化时，使用startMapUpdate()代替删除后重建
      * @param scene_name 场景名称
      * @param scene_type 场景类型（室内/室外普通/室外空旷）
      */
@@ -32,10 +46,31 @@ public:
 
     /**
      * 结束建图并保存（默认使用上一次的开始建图场景）
-     * @param scene_name 场景名称
+     * 立即返回，保存在机器人端后台多线程执行并边生成边写入，
+     * 期间工作模式为SAVING，进度通过subscribeMapSaveProgress()获取
      */
     void finishMapping();
 
+    /**
+     * 取消正在进行的地图保存
+     * 已写入的部分文件被删除，SLAM回到建图模式，可继续建图或重新保存
+     * @return true表示取消成功，不在保存中时返回false
+     */
+    bool cancelMapSaving();
+
+    /**
+     * 获取地图保存进度
+     * @return 保存进度，不在保存中时stage为IDLE
+     */
+    MapSaveProgress getMapSaveProgress() const;
+
+    /**
+     * 订阅地图保存进度事件
+     * 保存期间周期性上报，进入DONE/CANCELLED/FAILED阶段时上报最后一次
+     * @param callback 事件回调函数，传入空回调取消订阅
+     */
+    void subscribeMapSaveProgress(MapSaveProgressCallback callback);
+
     /**
      * 获取SLAM工作模式
      * @return 当前工作模式（0=空闲, 1=建图, 2=保存, 3=重定位, 4=定位）
@@ -55,12 +90,87 @@ public:
      */
     std::vector<MappingPathPoint> getMappingPathPoints() const;
 
+    /**
+     * 增量获取建图路径点
+     * 只返回游标之后新增的路径点，避免每次复制完整历史
+     * 每次开始建图后应将游标重置为0
+     * @param cursor [in/out] 游标，首次调用传0，返回时更新为已获取的路径点总数
+     * @return 新增的路径点
+     */
+    std::vector<MappingPathPoint> getMappingPathPointsSince(uint64_t& cursor) const;
+
+    /**
+     * 订阅建图路径点增量事件
+     * 每次有新路径点时推送新增部分
+     * @param callback 事件回调函数，传入空回调取消订阅
+     */
+    void subscribeMappingPath(MappingPathCallback callback);
+
+    /**
+     * 获取建图预览
+     * 由机器人端将正在构建的地图降采样为二维占据栅格
+     * @param resolution 预览分辨率 (米/格)
+     * @return 建图预览，不在建图模式时返回空栅格
+     */
+    MappingPreview getMappingPreview(float resolution = 0.2f) const;
+
+    /**
+     * 订阅建图预览事件
+     * @param callback 事件回调函数，传入空回调取消订阅
+     * @param resolution 预览分辨率 (米/格)
+     * @param max_rate_hz 最大上报频率 (Hz)
+     */
+    void subscribeMappingPreview(MappingPreviewCallback callback,
+                                 float resolution = 0.2f,
+                                 float max_rate_hz = 0.5f);
+
     /**
      * 检查是否正在建图
      * @return true表示正在建图
      */
     bool isMapping() const;
 
+    // ============ 局部地图更新 ============
+
+    /**
+     * 开始局部地图更新
+     * 机器人先在已有地图上定位，之后只在指定区域内重新建图；
+     * 区域外的子图保持不变并作为约束参与对齐，工作模式为MAPPING
+     * 需在已有地图上定位成功后调用，机器人应从区域外驶入
+     * @param scene_name 场景名称 (须已存在)
+     * @param sub_scene_id 子场景ID
+     * @param region 更新区域，地图坐标系
+     * @return true表示已开始更新，场景不存在或未定位时返回false
+     */
+    bool startMapUpdate(const std::string& scene_name,
+                        uint32_t sub_scene_id,
+                        const MapUpdateRegion& region);
+
+    /**
+     * 结束局部地图更新并合并
+     * 只重建与区域相交的子图并替换，栅格地图只重写受影响部分，
+     * 子场景ID、导航点、导航轨迹与全局位置索引中区域外的关键帧均保留；
+     * 合并在后台执行，进度通过subscribeMapSaveProgress()获取，可用cancelMapSaving()取消
+     */
+    void finishMapUpdate();
+
+    /**
+     * 放弃局部地图更新，原地图不变
+     */
+    void cancelMapUpdate();
+
+    /**
+     * 检查是否正在进行局部地图更新 (含合并阶段)
+     */
+    bool isUpdatingMap() const;
+
+    /**
+     * 获取最近一次局部地图更新的结果
+     * 若本地持有分块地图 (tiled_map.hpp)，只需重新获取与变化区域相交的瓦片
+     * @return 更新结果，尚未完成过更新时各字段为0
+     */
+    MapUpdateSummary getLastMapUpdateSummary() const;
+
     // ============ 定位功能 ============
 
     /**
@@ -69,6 +179,31 @@ public:
      */
     void startLocalization(const std::string& scene_name);
 
+    /**
+     * 开启定位并提供初始位姿
+     * 定位器在初始位姿附近搜索，跳过全局重定位
+     * @param scene_name 场景名称
+     * @param initial_pose 地图坐标系下的初始位姿估计
+     */
+    void startLocalization(const std::string& scene_name, const Pose& initial_pose);
+
+    /**
+     * 在给定初始位姿附近重定位
+     * 用于掉电重启或被搬动后，已知大致位置的情况
+     * @param initial_pose 地图坐标系下的初始位姿估计
+     * @param search_radius 搜索半径 (米)
+     * @return true表示重定位请求已接受，结果通过getWorkMode()/getErrorCode()查询
+     */
+    bool relocalize(const Pose& initial_pose, float search_radius = 2.0f);
+
+    /**
+     * 全局重定位
+     * 使用场景的全局位置索引 (ScanContext) 对当前帧做最近邻检索，得到初值后局部配准
+     * 场景在保存地图时自动生成位置索引，旧场景在首次调用时生成
+     * @return true表示重定位请求已接受，结果通过getWorkMode()/getErrorCode()查询
+     */
+    bool relocalizeGlobal();
+
     /**
      * 关闭定位
      * @param scene_name 场景名称
@@ -86,6 +221,68 @@ public:
      */
     bool isLocalized() const;
 
+    /**
+     * 订阅定位更新事件
+     * 定位器每输出一帧即触发一次 (不降频)，包含时间戳、协方差和匹配质量
+     * @param callback 事件回调函数，传入空回调取消订阅
+     */
+    void subscribeLocalization(LocalizationCallback callback);
+
+    /**
+     * 设置SDK内部定位历史的容量
+     * 启动定位后SDK将每帧定位更新写入内部PoseHistory
+     * @param capacity 历史容量 (帧)
+     */
+    void setLocalizationHistorySize(size_t capacity);
+
+    /**
+     * 查询指定时刻的定位位姿 (在内部定位历史中插值)
+     * 可在任意线程调用，不加锁
+     * @param timestamp 查询时刻 (秒，机器人时钟)
+     * @param update [out] 插值得到的定位信息
+     * @return true表示查询成功，时刻超出历史范围时返回false
+     */
+    bool getLocalizationAt(double timestamp, LocalizationUpdate& update) const;
+
+    // ============ 场景预加载 ============
+
+    /**
+     * 设置常驻场景数量上限
+     * 超出上限时按最近最少使用 (LRU) 淘汰，正在定位的场景不会被淘汰
+     * @param max_scenes 常驻场景数量
+     */
+    void setSceneCacheCapacity(uint32_t max_scenes);
+
+    /**
+     * 预加载场景地图
+     * 地图以内存映射方式常驻，后续切换无需重新读取和解析地图文件
+     * @param scene_name 场景名称
+     * @return true表示预加载成功
+     */
+    bool preloadScene(const std::string& scene_name);
+
+    /**
+     * 释放预加载的场景
+     * @param scene_name 场景名称
+     * @return true表示释放成功，场景未预加载或正在定位时返回false
+     */
+    bool evictScene(const std::string& scene_name);
+
+    /**
+     * 获取已预加载的场景列表
+     * @return 场景名称列表，按最近使用时间从新到旧排列
+     */
+    std::vector<std::string> getPreloadedScenes() const;
+
+    /**
+     * 切换定位场景 (如乘电梯换层)
+     * 目标场景已预加载时在常数时间内完成，不经过停止-加载流程；未预加载时先加载
+     * @param scene_name 目标场景名称
+     * @param initial_pose 目标场景地图坐标系下的初始位姿 (如电梯口位姿)
+     * @return true表示切换成功
+     */
+    bool switchLocalizationScene(const std::string& scene_name, const Pose& initial_pose);
+
     // ============ 轨迹录制功能 ============
 
     /**
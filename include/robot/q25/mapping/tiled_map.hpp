@@ -0,0 +1,557 @@
+#ifndef QUADRUPED_SDK_MAPPING_TILED_MAP_HPP
+#define QUADRUPED_SDK_MAPPING_TILED_MAP_HPP
+
+#include "../common/types.hpp"
+#include "../utils/varint.hpp"
+#include <algorithm>
+#include <cstdint>
+#include <cstdlib>
+#include <fstream>
+#include <limits>
+#include <sstream>
+#include <string>
+#include <vector>
+
+/**
+ * 分块压缩地图容器
+ * 将YAM+PGM栅格地图切分为定长瓦片，每个瓦片独立压缩并建立索引，
+ * 读取、下载、渲染时只需访问所需瓦片
+ *
+ * 文件格式 (小端):
+ *   头部 (48字节): "QTMP" | version(u8) | codec(u8) | reserved(u16)
+ *                  | width(u32) | height(u32) | tile_size(u32)
+ *                  | resolution(f32) | origin_x(f32) | origin_y(f32) | origin_yaw(f32)
+ *                  | negate(u32) | occupied_thresh(f32) | free_thresh(f32)
+ *   索引: 按行优先排列的每个瓦片 offset(u64) | size(u32)
+ *   数据: 各瓦片压缩后的像素 (图像坐标，行0为图像顶部)
+ */
+
+namespace robot {
+namespace q25 {
+
+/**
+ * 分块地图格式版本
+ */
+constexpr uint8_t TILED_MAP_VERSION = 1;
+
+/**
+ * 瓦片压缩方式
+ */
+enum class TileCodec : uint8_t {
+    NONE = 0,   // 不压缩
+    RLE = 1     // 游程编码 (PackBits)，适合大面积空闲/未知区域的占据栅格
+};
+
+/**
+ * 分块地图元数据 (对应YAM文件内容)
+ */
+struct TiledMapInfo {
+    uint32_t width;             // 地图宽度 (像素)
+    uint32_t height;            // 地图高度 (像素)
+    uint32_t tile_size;         // 瓦片边长 (像素)
+    float resolution;           // 分辨率 (米/像素)
+    float origin_x;             // 地图左下角x坐标 (米)
+    float origin_y;             // 地图左下角y坐标 (米)
+    float origin_yaw;           // 地图偏航角 (弧度)
+    uint32_t negate;            // 是否反色
+    float occupied_thresh;      // 占据阈值
+    float free_thresh;          // 空闲阈值
+    TileCodec codec;            // 瓦片压缩方式
+};
+
+namespace detail {
+
+inline void rleEncode(const uint8_t* data, size_t size, std::vector<uint8_t>& out) {
+    size_t i = 0;
+    while (i < size) {
+        size_t run = 1;
+        while (i + run < size && run < 128 && data[i + run] == data[i]) {
+            ++run;
+        }
+        if (run >= 2) {
+            out.push_back(static_cast<uint8_t>(257 - run));
+            out.push_back(data[i]);
+            i += run;
+            continue;
+        }
+        size_t start = i;
+        size_t count = 0;
+        while (i < size && count < 128 &&
+               !(i + 1 < size && data[i + 1] == data[i])) {
+            ++i;
+            ++count;
+        }
+        out.push_back(static_cast<uint8_t>(count - 1));
+        out.insert(out.end(), data + start, data + start + count);
+    }
+}
+
+inline bool rleDecode(const uint8_t* data, size_t size, std::vector<uint8_t>& out, size_t expected) {
+    out.clear();
+    out.reserve(expected);
+    size_t i = 0;
+    while (i < size) {
+        uint8_t n = data[i++];
+        if (n < 128) {
+            size_t count = static_cast<size_t>(n) + 1;
+            if (size - i < count) {
+                return false;
+            }
+            out.insert(out.end(), data + i, data + i + count);
+            i += count;
+        } else if (n > 128) {
+            if (i == size) {
+                return false;
+            }
+            out.insert(out.end(), static_cast<size_t>(257 - n), data[i++]);
+        }
+        if (out.size() > expected) {
+            return false;
+        }
+    }
+    return out.size() == expected;
+}
+
+inline bool readPgmToken(std::istream& in, std::string& token) {
+    token.clear();
+    char c = 0;
+    while (in.get(c)) {
+        if (c == '#') {
+            std::string comment;
+            std::getline(in, comment);
+        } else if (c == ' ' || c == '\t' || c == '\r' || c == '\n') {
+            if (!token.empty()) {
+                return true;
+            }
+        } else {
+            token.push_back(c);
+        }
+    }
+    return !token.empty();
+}
+
+} // namespace detail
+
+/**
+ * 读取PGM文件 (P5，最大灰度值须为255)
+ * 宽高为0或像素数超过文件剩余字节数时拒绝读取
+ * @param path PGM文件路径
+ * @param width [out] 宽度
+ * @param height [out] 高度
+ * @param pixels [out] 像素 (行优先，行0为图像顶部)
+ * @return true表示读取成功
+ */
+inline bool readPgm(const std::string& path, uint32_t& width, uint32_t& height,
+                    std::vector<uint8_t>& pixels) {
+    std::ifstream in(path.c_str(), std::ios::binary);
+    std::string magic, w, h, maxval;
+    if (!in || !detail::readPgmToken(in, magic) || magic != "P5" ||
+        !detail::readPgmToken(in, w) || !detail::readPgmToken(in, h) ||
+        !detail::readPgmToken(in, maxval) || maxval != "255" ||
+        w.find_first_not_of("0123456789") != std::string::npos || w.size() > 9 ||
+        h.find_first_not_of("0123456789") != std::string::npos || h.size() > 9) {
+        // 占据栅格依赖0/205/254等绝对灰度值，其他最大灰度值不做缩放
+        return false;
+    }
+    width = static_cast<uint32_t>(std::strtoul(w.c_str(), nullptr, 10));
+    height = static_cast<uint32_t>(std::strtoul(h.c_str(), nullptr, 10));
+    const std::streamoff data_start = in.tellg();
+    in.seekg(0, std::ios::end);
+    const std::streamoff remaining = in.tellg() - data_start;
+    const uint64_t count = static_cast<uint64_t>(width) * height;
+    if (width == 0 || height == 0 || data_start < 0 || remaining < 0 ||
+        count > static_cast<uint64_t>(remaining)) {
+        return false;
+    }
+    in.seekg(data_start);
+    pixels.resize(static_cast<size_t>(count));
+    if (!pixels.empty()) {
+        in.read(reinterpret_cast<char*>(&pixels[0]), static_cast<std::streamsize>(pixels.size()));
+    }
+    return in.gcount() == static_cast<std::streamsize>(pixels.size());
+}
+
+/**
+ * 写入PGM文件 (P5)
+ * @return true表示写入成功
+ */
+inline bool writePgm(const std::string& path, uint32_t width, uint32_t height,
+                     const std::vector<uint8_t>& pixels) {
+    if (pixels.size() != static_cast<size_t>(width) * height) {
+        return false;
+    }
+    std::ofstream out(path.c_str(), std::ios::binary);
+    out << "P5\n" << width << " " << height << "\n255\n";
+    if (!pixels.empty()) {
+        out.write(reinterpret_cast<const char*>(&pixels[0]), static_cast<std::streamsize>(pixels.size()));
+    }
+    return static_cast<bool>(out);
+}
+
+/**
+ * 读取YAM地图描述文件中的分辨率、原点和阈值
+ * 未出现的字段使用默认值
+ * @param path YAM文件路径
+ * @param info [out] 元数据 (width/height/tile_size/codec不修改)
+ * @return true表示读取成功
+ */
+inline bool readYam(const std::string& path, TiledMapInfo& info) {
+    std::ifstream in(path.c_str());
+    if (!in) {
+        return false;
+    }
+    info.resolution = 0.05f;
+    info.origin_x = info.origin_y = info.origin_yaw = 0.0f;
+    info.negate = 0;
+    info.occupied_thresh = 0.65f;
+    info.free_thresh = 0.196f;
+
+    std::string line;
+    while (std::getline(in, line)) {
+        size_t colon = line.find(':');
+        if (colon == std::string::npos) {
+            continue;
+        }
+        std::string key = line.substr(0, colon);
+        key.erase(0, key.find_first_not_of(" \t"));
+        key.erase(key.find_last_not_of(" \t") + 1);
+        std::string value = line.substr(colon + 1);
+        if (key == "resolution") {
+            info.resolution = std::strtof(value.c_str(), nullptr);
+        } else if (key == "negate") {
+            info.negate = static_cast<uint32_t>(std::atoi(value.c_str()));
+        } else if (key == "occupied_thresh") {
+            info.occupied_thresh = std::strtof(value.c_str(), nullptr);
+        } else if (key == "free_thresh") {
+            info.free_thresh = std::strtof(value.c_str(), nullptr);
+        } else if (key == "origin") {
+            for (size_t i = 0; i < value.size(); ++i) {
+                if (value[i] == '[' || value[i] == ']' || value[i] == ',') {
+                    value[i] = ' ';
+                }
+            }
+            std::istringstream ss(value);
+            ss >> info.origin_x >> info.origin_y >> info.origin_yaw;
+        }
+    }
+    return true;
+}
+
+/**
+ * 写入YAM地图描述文件
+ * @param path YAM文件路径
+ * @param image_name 对应的PGM文件名
+ * @param info 元数据
+ * @return true表示写入成功
+ */
+inline bool writeYam(const std::string& path, const std::string& image_name, const TiledMapInfo& info) {
+    std::ofstream out(path.c_str());
+    // 按float最大有效位数写出，保证分辨率与原点读回后逐位一致
+    out.precision(std::numeric_limits<float>::max_digits10);
+    out << "image: " << image_name << "\n"
+        << "resolution: " << info.resolution << "\n"
+        << "origin: [" << info.origin_x << ", " << info.origin_y << ", " << info.origin_yaw << "]\n"
+        << "negate: " << info.negate << "\n"
+        << "occupied_thresh: " << info.occupied_thresh << "\n"
+        << "free_thresh: " << info.free_thresh << "\n";
+    return static_cast<bool>(out);
+}
+
+/**
+ * 将栅格地图写入分块压缩容器
+ * @param path 输出文件路径
+ * @param info 元数据 (width/height须与像素一致)
+ * @param pixels 像素 (行优先，行0为图像顶部)
+ * @return true表示写入成功
+ */
+inline bool writeTiledMap(const std::string& path, const TiledMapInfo& info,
+                          const std::vector<uint8_t>& pixels) {
+    if (info.tile_size == 0 || pixels.size() != static_cast<size_t>(info.width) * info.height) {
+        return false;
+    }
+    const uint32_t cols = static_cast<uint32_t>((static_cast<uint64_t>(info.width) + info.tile_size - 1) / info.tile_size);
+    const uint32_t rows = static_cast<uint32_t>((static_cast<uint64_t>(info.height) + info.tile_size - 1) / info.tile_size);
+
+    std::vector<uint8_t> header;
+    header.push_back('Q');
+    header.push_back('T');
+    header.push_back('M');
+    header.push_back('P');
+    header.push_back(TILED_MAP_VERSION);
+    header.push_back(static_cast<uint8_t>(info.codec));
+    header.push_back(0);
+    header.push_back(0);
+    detail::writeU32(header, info.width);
+    detail::writeU32(header, info.height);
+    detail::writeU32(header, info.tile_size);
+    detail::writeFloat(header, info.resolution);
+    detail::writeFloat(header, info.origin_x);
+    detail::writeFloat(header, info.origin_y);
+    detail::writeFloat(header, info.origin_yaw);
+    detail::writeU32(header, info.negate);
+    detail::writeFloat(header, info.occupied_thresh);
+    detail::writeFloat(header, info.free_thresh);
+
+    const uint64_t data_start = header.size() + static_cast<uint64_t>(cols) * rows * 12;
+    std::vector<uint8_t> index;
+    std::vector<uint8_t> data;
+    std::vector<uint8_t> tile;
+    for (uint32_t row = 0; row < rows; ++row) {
+        for (uint32_t col = 0; col < cols; ++col) {
+            uint32_t x0 = col * info.tile_size;
+            uint32_t y0 = row * info.tile_size;
+            uint32_t w = std::min(info.tile_size, info.width - x0);
+            uint32_t h = std::min(info.tile_size, info.height - y0);
+            tile.clear();
+            for (uint32_t y = 0; y < h; ++y) {
+                const uint8_t* src = &pixels[static_cast<size_t>(y0 + y) * info.width + x0];
+                tile.insert(tile.end(), src, src + w);
+            }
+
+            size_t before = data.size();
+            if (info.codec == TileCodec::RLE) {
+                detail::rleEncode(tile.data(), tile.size(), data);
+            } else {
+                data.insert(data.end(), tile.begin(), tile.end());
+            }
+            detail::writeU64(index, data_start + before);
+            detail::writeU32(index, static_cast<uint32_t>(data.size() - before));
+        }
+    }
+
+    std::ofstream out(path.c_str(), std::ios::binary);
+    out.write(reinterpret_cast<const char*>(header.data()), static_cast<std::streamsize>(header.size()));
+    out.write(reinterpret_cast<const char*>(index.data()), static_cast<std::streamsize>(index.size()));
+    out.write(reinterpret_cast<const char*>(data.data()), static_cast<std::streamsize>(data.size()));
+    return static_cast<bool>(out);
+}
+
+/**
+ * 将YAM+PGM地图转换为分块压缩容器
+ * @param yam_path YAM文件路径
+ * @param pgm_path PGM文件路径
+ * @param out_path 输出文件路径
+ * @param tile_size 瓦片边长 (像素)
+ * @param codec 瓦片压缩方式
+ * @return true表示转换成功
+ */
+inline bool convertToTiledMap(const std::string& yam_path, const std::string& pgm_path,
+                              const std::string& out_path, uint32_t tile_size = 256,
+                              TileCodec codec = TileCodec::RLE) {
+    TiledMapInfo info = TiledMapInfo();
+    std::vector<uint8_t> pixels;
+    if (!readYam(yam_path, info) || !readPgm(pgm_path, info.width, info.height, pixels)) {
+        return false;
+    }
+    info.tile_size = tile_size;
+    info.codec = codec;
+    return writeTiledMap(out_path, info, pixels);
+}
+
+/**
+ * TiledMapReader - 分块压缩地图读取
+ * 打开时只读取头部和索引，瓦片按需读取和解压
+ */
+class TiledMapReader {
+public:
+    TiledMapReader() : info_(), cols_(0), rows_(0) {}
+
+    /**
+     * 打开分块地图文件
+     * @param path 文件路径
+     * @return true表示打开成功
+     */
+    bool open(const std::string& path) {
+        cols_ = rows_ = 0;
+        offsets_.clear();
+        sizes_.clear();
+        file_.close();
+        file_.clear();
+        file_.open(path.c_str(), std::ios::binary);
+        std::vector<uint8_t> header(48);
+        if (!file_ || !file_.read(reinterpret_cast<char*>(&header[0]), 48)) {
+            return false;
+        }
+        const uint8_t* p = &header[0];
+        const uint8_t* end = p + header.size();
+        if (p[0] != 'Q' || p[1] != 'T' || p[2] != 'M' || p[3] != 'P' || p[4] != TILED_MAP_VERSION ||
+            p[5] > static_cast<uint8_t>(TileCodec::RLE)) {
+            return false;
+        }
+        info_.codec = static_cast<TileCodec>(p[5]);
+        p += 8;
+        detail::readU32(p, end, info_.width);
+        detail::readU32(p, end, info_.height);
+        detail::readU32(p, end, info_.tile_size);
+        detail::readFloat(p, end, info_.resolution);
+        detail::readFloat(p, end, info_.origin_x);
+        detail::readFloat(p, end, info_.origin_y);
+        detail::readFloat(p, end, info_.origin_yaw);
+        detail::readU32(p, end, info_.negate);
+        detail::readFloat(p, end, info_.occupied_thresh);
+        detail::readFloat(p, end, info_.free_thresh);
+        if (info_.tile_size == 0) {
+            return false;
+        }
+
+        // 索引与各瓦片须完整位于文件内，避免损坏的头部或索引决定内存分配大小
+        const uint64_t cols = (static_cast<uint64_t>(info_.width) + info_.tile_size - 1) / info_.tile_size;
+        const uint64_t rows = (static_cast<uint64_t>(info_.height) + info_.tile_size - 1) / info_.tile_size;
+        file_.seekg(0, std::ios::end);
+        const std::streamoff file_end = file_.tellg();
+        if (file_end < 48) {
+            return false;
+        }
+        const uint64_t file_size = static_cast<uint64_t>(file_end);
+        if (cols * rows > (file_size - 48) / 12) {
+            return false;
+        }
+        const uint64_t index_size = cols * rows * 12;
+        std::vector<uint8_t> index(static_cast<size_t>(index_size));
+        file_.seekg(48);
+        if (!index.empty() && !file_.read(reinterpret_cast<char*>(&index[0]),
+                                          static_cast<std::streamsize>(index.size()))) {
+            return false;
+        }
+        std::vector<uint64_t> offsets(static_cast<size_t>(cols * rows));
+        std::vector<uint32_t> sizes(offsets.size());
+        p = index.data();
+        end = p + index.size();
+        for (size_t i = 0; i < offsets.size(); ++i) {
+            detail::readU64(p, end, offsets[i]);
+            detail::readU32(p, end, sizes[i]);
+            if (offsets[i] < 48 + index_size || offsets[i] > file_size ||
+                sizes[i] > file_size - offsets[i]) {
+                return false;
+            }
+        }
+        cols_ = static_cast<uint32_t>(cols);
+        rows_ = static_cast<uint32_t>(rows);
+        offsets_.swap(offsets);
+        sizes_.swap(sizes);
+        return true;
+    }
+
+    /**
+     * 获取元数据
+     */
+    const TiledMapInfo& getInfo() const { return info_; }
+
+    /**
+     * 获取瓦片列数
+     */
+    uint32_t getTileColumns() const { return cols_; }
+
+    /**
+     * 获取瓦片行数
+     */
+    uint32_t getTileRows() const { return rows_; }
+
+    /**
+     * 读取单个瓦片
+     * 边缘瓦片的宽高小于tile_size
+     * @param col 瓦片列
+     * @param row 瓦片行
+     * @param pixels [out] 瓦片像素 (行优先)
+     * @param width [out] 瓦片宽度
+     * @param height [out] 瓦片高度
+     * @return true表示读取成功
+     */
+    bool readTile(uint32_t col, uint32_t row, std::vector<uint8_t>& pixels,
+                  uint32_t& width, uint32_t& height) {
+        if (col >= cols_ || row >= rows_) {
+            return false;
+        }
+        width = std::min(info_.tile_size, info_.width - col * info_.tile_size);
+        height = std::min(info_.tile_size, info_.height - row * info_.tile_size);
+        const size_t expected = static_cast<size_t>(width) * height;
+        const size_t i = static_cast<size_t>(row) * cols_ + col;
+
+        buffer_.resize(sizes_[i]);
+        file_.clear();
+        file_.seekg(static_cast<std::streamoff>(offsets_[i]));
+        if (!buffer_.empty() &&
+            !file_.read(reinterpret_cast<char*>(&buffer_[0]), static_cast<std::streamsize>(buffer_.size()))) {
+            return false;
+        }
+        if (info_.codec == TileCodec::RLE) {
+            return detail::rleDecode(buffer_.data(), buffer_.size(), pixels, expected);
+        }
+        if (buffer_.size() != expected) {
+            return false;
+        }
+        pixels.swap(buffer_);
+        return true;
+    }
+
+    /**
+     * 读取矩形区域 (只读取与区域相交的瓦片)
+     * @param x 区域左上角列 (像素)
+     * @param y 区域左上角行 (像素)
+     * @param width 区域宽度 (像素)
+     * @param height 区域高度 (像素)
+     * @param pixels [out] 区域像素 (行优先)，超出地图的部分填充205 (未知)
+     * @return true表示读取成功
+     */
+    bool readRegion(uint32_t x, uint32_t y, uint32_t width, uint32_t height,
+                    std::vector<uint8_t>& pixels) {
+        pixels.assign(static_cast<size_t>(width) * height, 205);
+        if (width == 0 || height == 0 || x >= info_.width || y >= info_.height) {
+            return true;
+        }
+        const uint32_t x1 = width > info_.width - x ? info_.width : x + width;
+        const uint32_t y1 = height > info_.height - y ? info_.height : y + height;
+        const uint32_t last_col = (x1 - 1) / info_.tile_size;
+        const uint32_t last_row = (y1 - 1) / info_.tile_size;
+        std::vector<uint8_t> tile;
+        for (uint32_t row = y / info_.tile_size; row <= last_row; ++row) {
+            for (uint32_t col = x / info_.tile_size; col <= last_col; ++col) {
+                uint32_t tw = 0, th = 0;
+                if (!readTile(col, row, tile, tw, th)) {
+                    return false;
+                }
+                const uint32_t tx0 = col * info_.tile_size;
+                const uint32_t ty0 = row * info_.tile_size;
+                const uint32_t cx0 = std::max(x, tx0), cx1 = std::min(x1, tx0 + tw);
+                const uint32_t cy0 = std::max(y, ty0), cy1 = std::min(y1, ty0 + th);
+                for (uint32_t py = cy0; py < cy1; ++py) {
+                    const uint8_t* src = &tile[static_cast<size_t>(py - ty0) * tw + (cx0 - tx0)];
+                    uint8_t* dst = &pixels[static_cast<size_t>(py - y) * width + (cx0 - x)];
+                    std::copy(src, src + (cx1 - cx0), dst);
+                }
+            }
+        }
+        return true;
+    }
+
+    /**
+     * 导出为YAM+PGM地图
+     * @param yam_path YAM文件路径
+     * @param pgm_path PGM文件路径 (YAM中记录其文件名)
+     * @return true表示导出成功
+     */
+    bool exportPgm(const std::string& yam_path, const std::string& pgm_path) {
+        std::vector<uint8_t> pixels;
+        if (!readRegion(0, 0, info_.width, info_.height, pixels)) {
+            return false;
+        }
+        size_t slash = pgm_path.find_last_of("/\\");
+        std::string image_name = slash == std::string::npos ? pgm_path : pgm_path.substr(slash + 1);
+        return writePgm(pgm_path, info_.width, info_.height, pixels) &&
+               writeYam(yam_path, image_name, info_);
+    }
+
+private:
+    TiledMapInfo info_;
+    uint32_t cols_;
+    uint32_t rows_;
+    std::vector<uint64_t> offsets_;
+    std::vector<uint32_t> sizes_;
+    std::vector<uint8_t> buffer_;
+    std::ifstream file_;
+};
+
+} // namespace q25
+} // namespace robot
+
+#endif // QUADRUPED_SDK_MAPPING_TILED_MAP_HPP
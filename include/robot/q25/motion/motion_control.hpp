@@ -2,18 +2,34 @@
 #define QUADRUPED_SDK_MOTION_CONTROL_HPP
 
 #include "../common/types.hpp"
+#include <future>
 
 namespace robot {
 namespace q25 {
 
+// 前向声明
+class Robot;
+
 /**
  * MotionController - 运动控制接口
  * 提供精细的运动控制功能
  * 可独立使用，不依赖其他模块
+ * 急停、轴控制等命令经优先命令通道发送，带序号确认，不受批量传输影响
+ * (参见 CommandChannelOptions)
  */
 class MotionController {
 public:
+    /**
+     * 构造函数，绑定到默认机器人实例 (进程内首个创建的Robot)
+     */
     MotionController();
+
+    /**
+     * 构造函数，绑定到指定机器人实例
+     * 同一进程可为多个Robot分别创建模块对象
+     * @param robot 机器人实例 (生命周期须长于本对象)
+     */
+    explicit MotionController(Robot& robot);
     ~MotionController();
 
     // 禁用复制
@@ -145,6 +161,63 @@ public:
      */
     bool setMaxAngularVelocity(float max_angular_velocity);
 
+    // ============ 异步命令 ============
+    //
+    // 以下接口立即返回，命令确认后future就绪 (true表示成功)
+    // 多条互不依赖的命令可同时在途，机器人按发送顺序执行，
+    // 例如任务准备阶段的setGait、setSpeedLevel、setBodyHeight、setMaxLinearVelocity可一次发出
+    // 注意: EXTERNAL事件循环模式下不要在事件循环线程中阻塞等待future
+
+    /**
+     * stand()的异步版本
+     */
+    std::future<bool> standAsync();
+
+    /**
+     * lie()的异步版本
+     */
+    std::future<bool> lieAsync();
+
+    /**
+     * setMotionMode()的异步版本
+     */
+    std::future<bool> setMotionModeAsync(MotionMode mode);
+
+    /**
+     * setGait()的异步版本
+     */
+    std::future<bool> setGaitAsync(GaitType gait);
+
+    /**
+     * setSpeedLevel()的异步版本
+     */
+    std::future<bool> setSpeedLevelAsync(SpeedLevel level);
+
+    /**
+     * setBodyHeight()的异步版本
+     */
+    std::future<bool> setBodyHeightAsync(float height);
+
+    /**
+     * setBodyPose()的异步版本
+     */
+    std::future<bool> setBodyPoseAsync(float roll, float pitch, float yaw);
+
+    /**
+     * resetBodyPose()的异步版本
+     */
+    std::future<bool> resetBodyPoseAsync();
+
+    /**
+     * setMaxLinearVelocity()的异步版本
+     */
+    std::future<bool> setMaxLinearVelocityAsync(float max_linear_velocity);
+
+    /**
+     * setMaxAngularVelocity()的异步版本
+     */
+    std::future<bool> setMaxAngularVelocityAsync(float max_angular_velocity);
+
 private:
     struct Impl;
     Impl* impl_;
@@ -7,6 +7,9 @@
 namespace robot {
 namespace q25 {
 
+// 前向声明
+class Robot;
+
 /**
  * 运动状态信息
  */
@@ -30,7 +33,17 @@ struct MotionState {
  */
 class MotionStateMonitor {
 public:
+    /**
+     * 构造函数，绑定到默认机器人实例 (进程内首个创建的Robot)
+     */
     MotionStateMonitor();
+
+    /**
+     * 构造函数，绑定到指定机器人实例
+     * 同一进程可为多个Robot分别创建模块对象
+     * @param robot 机器人实例 (生命周期须长于本对象)
+     */
+    explicit MotionStateMonitor(Robot& robot);
     ~MotionStateMonitor();
 
     // 禁用复制
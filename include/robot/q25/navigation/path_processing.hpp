@@ -0,0 +1,269 @@
+#ifndef QUADRUPED_SDK_NAVIGATION_PATH_PROCESSING_HPP
+#define QUADRUPED_SDK_NAVIGATION_PATH_PROCESSING_HPP
+
+#include "../common/math.hpp"
+#include "../common/types.hpp"
+#include "../utils/varint.hpp"
+#include <cmath>
+#include <cstdint>
+#include <string>
+#include <utility>
+#include <vector>
+
+/**
+ * 路径后处理工具
+ * 对录制得到的稠密路径进行抽稀、平滑以及紧凑二进制编码
+ * 纯本地计算，不依赖机器人连接
+ *
+ * 编码格式 (版本1，所有整数为小端/变长编码):
+ *   "QP" | version(u8) | resolution(f32) | path_id(zigzag varint)
+ *   | name_len(varint) name | count(varint)
+ *   | 每个位姿: dx dy dz (zigzag varint，按resolution量化后相对上一点的增量)
+ *               dqx dqy dqz dqw (zigzag varint，四元数分量按1/32767量化后的增量)
+ */
+
+namespace robot {
+namespace q25 {
+
+/**
+ * 路径编码格式版本
+ */
+constexpr uint8_t PATH_ENCODING_VERSION = 1;
+
+namespace detail {
+
+inline float pointSegmentDistance(const Point3D& p, const Point3D& a, const Point3D& b) {
+    float abx = b.x - a.x, aby = b.y - a.y, abz = b.z - a.z;
+    float apx = p.x - a.x, apy = p.y - a.y, apz = p.z - a.z;
+    float len2 = abx * abx + aby * aby + abz * abz;
+    float t = len2 > 0.0f ? (apx * abx + apy * aby + apz * abz) / len2 : 0.0f;
+    t = t < 0.0f ? 0.0f : (t > 1.0f ? 1.0f : t);
+    float dx = apx - t * abx, dy = apy - t * aby, dz = apz - t * abz;
+    return std::sqrt(dx * dx + dy * dy + dz * dz);
+}
+
+inline float catmullRom(float p0, float p1, float p2, float p3, float t) {
+    float t2 = t * t;
+    float t3 = t2 * t;
+    return 0.5f * (2.0f * p1 + (p2 - p0) * t +
+                   (2.0f * p0 - 5.0f * p1 + 4.0f * p2 - p3) * t2 +
+                   (3.0f * p1 - p0 - 3.0f * p2 + p3) * t3);
+}
+
+} // namespace detail
+
+/**
+ * 路径抽稀 (Douglas-Peucker)
+ * 保留首末点，删除偏离折线不超过tolerance的中间点，保留点的姿态不变
+ * @param path 原始路径
+ * @param tolerance 允许的最大偏差 (米)
+ * @return 抽稀后的路径
+ */
+inline NavigationPath simplifyPath(const NavigationPath& path, float tolerance) {
+    NavigationPath result;
+    result.path_id = path.path_id;
+    result.path_name = path.path_name;
+    const std::vector<Pose>& pts = path.points;
+    if (pts.size() < 3 || tolerance <= 0.0f) {
+        result.points = pts;
+        return result;
+    }
+
+    std::vector<bool> keep(pts.size(), false);
+    keep.front() = true;
+    keep.back() = true;
+
+    // 显式栈，避免长路径递归过深
+    std::vector<std::pair<size_t, size_t> > stack;
+    stack.push_back(std::make_pair(size_t(0), pts.size() - 1));
+    while (!stack.empty()) {
+        size_t first = stack.back().first;
+        size_t last = stack.back().second;
+        stack.pop_back();
+
+        float max_dist = 0.0f;
+        size_t index = first;
+        for (size_t i = first + 1; i < last; ++i) {
+            float d = detail::pointSegmentDistance(pts[i].position,
+                                                   pts[first].position,
+                                                   pts[last].position);
+            if (d > max_dist) {
+                max_dist = d;
+                index = i;
+            }
+        }
+        if (max_dist > tolerance) {
+            keep[index] = true;
+            stack.push_back(std::make_pair(first, index));
+            stack.push_back(std::make_pair(index, last));
+        }
+    }
+
+    for (size_t i = 0; i < pts.size(); ++i) {
+        if (keep[i]) {
+            result.points.push_back(pts[i]);
+        }
+    }
+    return result;
+}
+
+/**
+ * 路径平滑 (Catmull-Rom样条)
+ * 曲线经过所有原始点，每段之间插入samples_per_segment-1个插值点，姿态线性插值
+ * 通常先用simplifyPath()抽稀再平滑
+ * @param path 原始路径
+ * @param samples_per_segment 每段采样数 (>=1，1表示不插值)
+ * @return 平滑后的路径
+ */
+inline NavigationPath smoothPath(const NavigationPath& path, uint32_t samples_per_segment) {
+    NavigationPath result;
+    result.path_id = path.path_id;
+    result.path_name = path.path_name;
+    const std::vector<Pose>& pts = path.points;
+    if (pts.size() < 3 || samples_per_segment <= 1) {
+        result.points = pts;
+        return result;
+    }
+
+    const size_t n = pts.size();
+    result.points.reserve((n - 1) * samples_per_segment + 1);
+    for (size_t i = 0; i + 1 < n; ++i) {
+        const Point3D& p0 = pts[i == 0 ? 0 : i - 1].position;
+        const Point3D& p1 = pts[i].position;
+        const Point3D& p2 = pts[i + 1].position;
+        const Point3D& p3 = pts[i + 2 < n ? i + 2 : n - 1].position;
+        for (uint32_t k = 0; k < samples_per_segment; ++k) {
+            float t = static_cast<float>(k) / samples_per_segment;
+            Pose pose;
+            pose.position.x = detail::catmullRom(p0.x, p1.x, p2.x, p3.x, t);
+            pose.position.y = detail::catmullRom(p0.y, p1.y, p2.y, p3.y, t);
+            pose.position.z = detail::catmullRom(p0.z, p1.z, p2.z, p3.z, t);
+            pose.orientation = detail::nlerp(pts[i].orientation, pts[i + 1].orientation, t);
+            result.points.push_back(pose);
+        }
+    }
+    result.points.push_back(pts.back());
+    return result;
+}
+
+/**
+ * 将路径编码为紧凑二进制格式 (增量 + 量化 + 变长整数)
+ * @param path 导航路径
+ * @param resolution 位置量化精度 (米)
+ * @return 编码数据，精度无效或路径含非有限值/超出量化范围的位姿时返回空
+ */
+inline std::vector<uint8_t> encodePath(const NavigationPath& path, float resolution = 0.001f) {
+    std::vector<uint8_t> out;
+    if (!(resolution > 0.0f) || !std::isfinite(resolution)) {
+        return out;
+    }
+    out.reserve(16 + path.path_name.size() + path.points.size() * 8);
+    out.push_back('Q');
+    out.push_back('P');
+    out.push_back(PATH_ENCODING_VERSION);
+
+    detail::writeFloat(out, resolution);
+
+    detail::writeSigned(out, path.path_id);
+    detail::writeVarint(out, path.path_name.size());
+    out.insert(out.end(), path.path_name.begin(), path.path_name.end());
+    detail::writeVarint(out, path.points.size());
+
+    int64_t prev[7] = { 0, 0, 0, 0, 0, 0, 0 };
+    for (size_t i = 0; i < path.points.size(); ++i) {
+        const Pose& p = path.points[i];
+        const float values[7] = {
+            p.position.x / resolution, p.position.y / resolution, p.position.z / resolution,
+            p.orientation.x * 32767.0f, p.orientation.y * 32767.0f,
+            p.orientation.z * 32767.0f, p.orientation.w * 32767.0f
+        };
+        for (int k = 0; k < 7; ++k) {
+            // 量化值限制在±4e18内，保证llround与相邻差值不溢出
+            if (!std::isfinite(values[k]) || std::fabs(values[k]) > 4e18f) {
+                return std::vector<uint8_t>();
+            }
+            int64_t q = static_cast<int64_t>(std::llround(values[k]));
+            detail::writeSigned(out, q - prev[k]);
+            prev[k] = q;
+        }
+    }
+    return out;
+}
+
+/**
+ * 解码encodePath()生成的二进制数据
+ * @param data 编码数据
+ * @param size 数据长度 (字节)
+ * @param path [out] 解码后的路径
+ * @return true表示解码成功，格式或版本不匹配、精度无效时返回false
+ */
+inline bool decodePath(const uint8_t* data, size_t size, NavigationPath& path) {
+    const uint8_t* p = data;
+    const uint8_t* end = data + size;
+    if (size < 7 || p[0] != 'Q' || p[1] != 'P' || p[2] != PATH_ENCODING_VERSION) {
+        return false;
+    }
+    p += 3;
+
+    float resolution = 0.0f;
+    int64_t path_id = 0;
+    uint64_t name_len = 0;
+    if (!detail::readFloat(p, end, resolution) ||
+        !detail::readSigned(p, end, path_id) ||
+        !(resolution > 0.0f) || !std::isfinite(resolution) ||
+        !detail::readVarint(p, end, name_len) ||
+        name_len > static_cast<uint64_t>(end - p)) {
+        return false;
+    }
+    std::string name(reinterpret_cast<const char*>(p), static_cast<size_t>(name_len));
+    p += name_len;
+
+    uint64_t count = 0;
+    // 每个位姿至少占7字节，防止损坏数据导致超大分配
+    if (!detail::readVarint(p, end, count) || count > static_cast<uint64_t>(end - p) / 7) {
+        return false;
+    }
+
+    std::vector<Pose> points(static_cast<size_t>(count));
+    // 以无符号数累加，损坏数据不会触发有符号溢出
+    uint64_t acc[7] = { 0, 0, 0, 0, 0, 0, 0 };
+    int64_t prev[7];
+    for (size_t i = 0; i < points.size(); ++i) {
+        for (int k = 0; k < 7; ++k) {
+            int64_t delta = 0;
+            if (!detail::readSigned(p, end, delta)) {
+                return false;
+            }
+            acc[k] += static_cast<uint64_t>(delta);
+            prev[k] = static_cast<int64_t>(acc[k]);
+        }
+        Pose& pose = points[i];
+        pose.position.x = prev[0] * resolution;
+        pose.position.y = prev[1] * resolution;
+        pose.position.z = prev[2] * resolution;
+        pose.orientation.x = prev[3] / 32767.0f;
+        pose.orientation.y = prev[4] / 32767.0f;
+        pose.orientation.z = prev[5] / 32767.0f;
+        pose.orientation.w = prev[6] / 32767.0f;
+    }
+
+    path.path_id = static_cast<int32_t>(path_id);
+    path.path_name.swap(name);
+    path.points.swap(points);
+    return true;
+}
+
+/**
+ * 解码encodePath()生成的二进制数据
+ * @param data 编码数据
+ * @param path [out] 解码后的路径
+ * @return true表示解码成功
+ */
+inline bool decodePath(const std::vector<uint8_t>& data, NavigationPath& path) {
+    return decodePath(data.empty() ? nullptr : &data[0], data.size(), path);
+}
+
+} // namespace q25
+} // namespace robot
+
+#endif // QUADRUPED_SDK_NAVIGATION_PATH_PROCESSING_HPP
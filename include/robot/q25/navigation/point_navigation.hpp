@@ -2,12 +2,156 @@
 #define QUADRUPED_SDK_NAVIGATION_POINT_NAVIGATION_HPP
 
 #include "../common/types.hpp"
+#include <future>
 #include <vector>
 #include <string>
 
 namespace robot {
 namespace q25 {
 
+// 前向声明
+class Robot;
+
+/**
+ * 导航目标类型
+ */
+enum class NavigationGoalType {
+    WAY_POINT = 0,      // 已保存的导航点
+    POSE = 1            // 任意位姿
+};
+
+/**
+ * 到达目标后的停留动作
+ */
+enum class GoalDwellAction {
+    PASS_THROUGH = 0,   // 不停留，平滑衔接下一目标
+    WAIT = 1,           // 停留 dwell_time 秒后继续
+    HOLD = 2            // 停留直至调用 continueGoalQueue()
+};
+
+/**
+ * 导航队列目标
+ */
+struct NavigationGoal {
+    NavigationGoalType type;        // 目标类型
+    uint32_t point_id;              // 导航点ID (WAY_POINT类型有效)
+    Pose pose;                      // 目标位姿 (POSE类型有效)
+    float position_tolerance;       // 到达位置容差 (米)，<=0 使用默认值
+    float yaw_tolerance;            // 到达朝向容差 (弧度)，<=0 使用默认值
+    GoalDwellAction dwell_action;   // 到达后停留动作
+    float dwell_time;               // 停留时间 (秒，仅WAIT有效)
+};
+
+/**
+ * 导航编辑操作类型
+ */
+enum class NavigationEditType {
+    UPDATE_WAY_POINT = 0,   // 更新导航点位姿
+    ADD_WAY_POINT = 1,      // 新增导航点
+    DELETE_WAY_POINT = 2,   // 删除导航点
+    ADD_PATH = 3,           // 新增路径
+    DELETE_PATH = 4         // 删除路径
+};
+
+/**
+ * 导航编辑操作
+ */
+struct NavigationEdit {
+    NavigationEditType type;    // 操作类型
+    NavigationPoint point;      // 导航点 (导航点操作有效，DELETE仅需point_id)
+    NavigationPath path;        // 路径 (路径操作有效，DELETE仅需path_id)
+};
+
+/**
+ * 批量编辑提交结果
+ */
+struct NavigationEditResult {
+    bool success;               // 是否全部提交成功 (失败时全部回滚)
+    uint32_t failed_index;      // 首个失败操作的索引 (success为false时有效)
+    uint32_t trajectory_version; // 提交后的轨迹版本号
+};
+
+/**
+ * NavigationEditBatch - 导航点/路径批量编辑
+ * 在本地暂存编辑操作，由PointNavigation::commitEdits()一次性提交
+ */
+class NavigationEditBatch {
+public:
+    /**
+     * 暂存导航点位姿更新
+     */
+    void updateWayPoint(uint32_t point_id, const Pose& pose) {
+        NavigationEdit edit = NavigationEdit();
+        edit.type = NavigationEditType::UPDATE_WAY_POINT;
+        edit.point.point_id = static_cast<int32_t>(point_id);
+        edit.point.pose = pose;
+        edits_.push_back(edit);
+    }
+
+    /**
+     * 暂存新增导航点
+     */
+    void addWayPoint(const NavigationPoint& point) {
+        NavigationEdit edit = NavigationEdit();
+        edit.type = NavigationEditType::ADD_WAY_POINT;
+        edit.point = point;
+        edits_.push_back(edit);
+    }
+
+    /**
+     * 暂存删除导航点
+     */
+    void deleteWayPoint(uint32_t point_id) {
+        NavigationEdit edit = NavigationEdit();
+        edit.type = NavigationEditType::DELETE_WAY_POINT;
+        edit.point.point_id = static_cast<int32_t>(point_id);
+        edits_.push_back(edit);
+    }
+
+    /**
+     * 暂存新增路径
+     */
+    void addPath(const NavigationPath& path) {
+        NavigationEdit edit = NavigationEdit();
+        edit.type = NavigationEditType::ADD_PATH;
+        edit.path = path;
+        edits_.push_back(edit);
+    }
+
+    /**
+     * 暂存删除路径
+     */
+    void deletePath(uint32_t path_id) {
+        NavigationEdit edit = NavigationEdit();
+        edit.type = NavigationEditType::DELETE_PATH;
+        edit.path.path_id = static_cast<int32_t>(path_id);
+        edits_.push_back(edit);
+    }
+
+    /**
+     * 清空暂存的操作
+     */
+    void clear() { edits_.clear(); }
+
+    /**
+     * 获取暂存的操作数量
+     */
+    size_t size() const { return edits_.size(); }
+
+    /**
+     * 检查是否没有暂存的操作
+     */
+    bool empty() const { return edits_.empty(); }
+
+    /**
+     * 获取暂存的操作列表
+     */
+    const std::vector<NavigationEdit>& getEdits() const { return edits_; }
+
+private:
+    std::vector<NavigationEdit> edits_;
+};
+
 /**
  * PointNavigation - 定点导航接口
  * 提供基于场景和导航点的定点导航功能
@@ -15,7 +159,17 @@ namespace q25 {
  */
 class PointNavigation {
 public:
+    /**
+     * 构造函数，绑定到默认机器人实例 (进程内首个创建的Robot)
+     */
     PointNavigation();
+
+    /**
+     * 构造函数，绑定到指定机器人实例
+     * 同一进程可为多个Robot分别创建模块对象
+     * @param robot 机器人实例 (生命周期须长于本对象)
+     */
+    explicit PointNavigation(Robot& robot);
     ~PointNavigation();
 
     // 禁用复制
@@ -32,6 +186,7 @@ public:
 
     /**
      * 加载场景
+     * 场景已通过SLAM::preloadScene()预加载时直接切换，无需重新读取地图
      * @param scene_id 场景ID
      * @return true表示加载成功
      */
@@ -66,6 +221,14 @@ public:
      */
     bool updateWayPoint(uint32_t point_id, const Pose& pose);
 
+    /**
+     * 批量提交导航点/路径编辑
+     * 所有操作在一条消息中提交，全部成功或全部回滚，成功时轨迹版本号只增加一次
+     * @param batch 暂存的编辑操作
+     * @return 提交结果
+     */
+    NavigationEditResult commitEdits(const NavigationEditBatch& batch);
+
     // ============ 导航控制 ============
 
     /**
@@ -100,6 +263,50 @@ public:
      */
     bool resumeNavigation();
 
+    // ============ 多目标导航队列 ============
+
+    /**
+     * 按顺序导航经过一组目标
+     * 当前目标完成前即将后续目标下发至机器人，PASS_THROUGH目标之间不停车
+     * 会替换正在执行的单点导航或导航队列
+     * @param goals 目标序列
+     * @param lookahead 提前下发的后续目标数量 (至少为1)
+     * @return true表示导航队列启动成功
+     */
+    bool navigateGoalQueue(const std::vector<NavigationGoal>& goals, uint32_t lookahead = 1);
+
+    /**
+     * 向正在执行的导航队列末尾追加目标
+     * @param goals 追加的目标序列
+     * @return true表示追加成功，无执行中的队列时返回false
+     */
+    bool appendGoals(const std::vector<NavigationGoal>& goals);
+
+    /**
+     * 清空尚未执行的目标，当前目标完成后停止
+     * 立即停止请使用cancelNavigation()
+     * @return true表示清空成功
+     */
+    bool clearGoalQueue();
+
+    /**
+     * 结束HOLD停留，继续执行下一目标
+     * @return true表示继续成功
+     */
+    bool continueGoalQueue();
+
+    /**
+     * 获取当前执行的目标在队列中的索引
+     * @return 目标索引，无执行中的队列时返回-1
+     */
+    int32_t getCurrentGoalIndex() const;
+
+    /**
+     * 获取导航队列中的目标总数 (含已完成目标)
+     * @return 目标数量
+     */
+    uint32_t getGoalQueueSize() const;
+
     // ============ 状态查询 ============
 
     /**
@@ -120,6 +327,51 @@ public:
      */
     float getDistanceToTarget() const;
 
+    // ============ 事件订阅 ============
+
+    /**
+     * 订阅导航状态变化事件
+     * 仅在状态发生迁移时触发 (如 RUNNING -> FINISHED)，无需轮询getNavigationStatus()
+     * @param callback 事件回调函数，传入空回调取消订阅
+     */
+    void subscribeNavigationStatus(NavigationStatusCallback callback);
+
+    /**
+     * 订阅导航进度事件
+     * 导航执行期间按不超过max_rate_hz的频率上报剩余距离、当前队列目标索引和预计剩余时间
+     * @param callback 事件回调函数，传入空回调取消订阅
+     * @param max_rate_hz 最大上报频率 (Hz)
+     */
+    void subscribeNavigationProgress(NavigationProgressCallback callback, float max_rate_hz = 2.0f);
+
+    // ============ 异步命令 ============
+    // future在机器人接受命令后就绪，不等待导航结束 (结束请订阅导航状态事件)
+
+    /**
+     * navigateToPoint()的异步版本
+     */
+    std::future<bool> navigateToPointAsync(uint32_t point_id);
+
+    /**
+     * navigateToPose()的异步版本
+     */
+    std::future<bool> navigateToPoseAsync(const Pose& pose);
+
+    /**
+     * cancelNavigation()的异步版本
+     */
+    std::future<bool> cancelNavigationAsync();
+
+    /**
+     * pauseNavigation()的异步版本
+     */
+    std::future<bool> pauseNavigationAsync();
+
+    /**
+     * resumeNavigation()的异步版本
+     */
+    std::future<bool> resumeNavigationAsync();
+
 private:
     struct Impl;
     Impl* impl_;
@@ -2,12 +2,16 @@
 #define QUADRUPED_SDK_NAVIGATION_TRACK_NAVIGATION_HPP
 
 #include "../common/types.hpp"
+#include <future>
 #include <vector>
 #include <string>
 
 namespace robot {
 namespace q25 {
 
+// 前向声明
+class Robot;
+
 /**
  * TrackNavigation - 循迹导航接口
  * 提供基于路径的循迹导航功能
@@ -15,7 +19,17 @@ namespace q25 {
  */
 class TrackNavigation {
 public:
+    /**
+     * 构造函数，绑定到默认机器人实例 (进程内首个创建的Robot)
+     */
     TrackNavigation();
+
+    /**
+     * 构造函数，绑定到指定机器人实例
+     * 同一进程可为多个Robot分别创建模块对象
+     * @param robot 机器人实例 (生命周期须长于本对象)
+     */
+    explicit TrackNavigation(Robot& robot);
     ~TrackNavigation();
 
     // 禁用复制
@@ -157,6 +171,46 @@ public:
      */
     bool isForwardDirection() const;
 
+    // ============ 事件订阅 ============
+
+    /**
+     * 订阅导航状态变化事件
+     * 仅在状态发生迁移时触发 (如 RUNNING -> FINISHED)，无需轮询getNavigationStatus()
+     * @param callback 事件回调函数，传入空回调取消订阅
+     */
+    void subscribeNavigationStatus(NavigationStatusCallback callback);
+
+    /**
+     * 订阅导航进度事件
+     * 导航执行期间按不超过max_rate_hz的频率上报剩余距离、当前路径点索引和预计剩余时间
+     * @param callback 事件回调函数，传入空回调取消订阅
+     * @param max_rate_hz 最大上报频率 (Hz)
+     */
+    void subscribeNavigationProgress(NavigationProgressCallback callback, float max_rate_hz = 2.0f);
+
+    // ============ 异步命令 ============
+    // future在机器人接受命令后就绪，循迹完成请订阅导航状态事件
+
+    /**
+     * startTrackFollowing()的异步版本
+     */
+    std::future<bool> startTrackFollowingAsync(uint32_t path_id, bool forward = true, bool loop = false);
+
+    /**
+     * stopTrackFollowing()的异步版本
+     */
+    std::future<bool> stopTrackFollowingAsync();
+
+    /**
+     * pauseTrackFollowing()的异步版本
+     */
+    std::future<bool> pauseTrackFollowingAsync();
+
+    /**
+     * resumeTrackFollowing()的异步版本
+     */
+    std::future<bool> resumeTrackFollowingAsync();
+
 private:
     struct Impl;
     Impl* impl_;
@@ -0,0 +1,448 @@
+#ifndef QUADRUPED_SDK_NAVIGATION_WAYPOINT_GRAPH_HPP
+#define QUADRUPED_SDK_NAVIGATION_WAYPOINT_GRAPH_HPP
+
+#include "../common/types.hpp"
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <functional>
+#include <limits>
+#include <queue>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace robot {
+namespace q25 {
+
+/**
+ * 路网边 (CSR邻接表中的一条有向边)
+ */
+struct RouteEdge {
+    uint32_t target;    // 目标导航点索引
+    float cost;         // 路线代价 (米)
+    int32_t path_id;    // 来源路径ID
+};
+
+/**
+ * WaypointGraph - 导航点路网索引
+ * 由导航轨迹中的导航点和路径构建紧凑的CSR路网，并预计算全源最短路线代价
+ * 路径首末位姿吸附到最近的导航点形成边，边代价为路径折线长度；路径ID重复时保留首条
+ * 增删路径时增量更新代价矩阵，多点巡逻排序可直接查表
+ * 纯本地计算，不依赖机器人连接
+ */
+class WaypointGraph {
+public:
+    WaypointGraph() : snap_tolerance_(0.5f) {}
+
+    /**
+     * 由导航轨迹构建路网
+     * @param trajectory 导航轨迹 (导航点 + 路径)
+     * @param snap_tolerance 路径端点吸附到导航点的最大距离 (米)
+     * @param bidirectional 路径是否按双向处理
+     */
+    explicit WaypointGraph(const NavigationTrajectory& trajectory,
+                           float snap_tolerance = 0.5f,
+                           bool bidirectional = true)
+        : snap_tolerance_(snap_tolerance) {
+        build(trajectory, snap_tolerance, bidirectional);
+    }
+
+    // ============ 路网构建 ============
+
+    /**
+     * 重新构建路网并计算全源最短路线代价
+     * @param trajectory 导航轨迹
+     * @param snap_tolerance 路径端点吸附距离 (米)
+     * @param bidirectional 路径是否按双向处理
+     */
+    void build(const NavigationTrajectory& trajectory,
+               float snap_tolerance = 0.5f,
+               bool bidirectional = true) {
+        snap_tolerance_ = snap_tolerance;
+        ids_.clear();
+        positions_.clear();
+        sub_scenes_.clear();
+        sub_scene_list_.clear();
+        index_.clear();
+        path_edges_.clear();
+
+        for (size_t i = 0; i < trajectory.waypoints.size(); ++i) {
+            const NavigationPoint& wp = trajectory.waypoints[i];
+            if (index_.count(wp.point_id)) {
+                continue;
+            }
+            index_[wp.point_id] = static_cast<uint32_t>(ids_.size());
+            ids_.push_back(wp.point_id);
+            positions_.push_back(wp.pose.position);
+            sub_scenes_.push_back(wp.sub_scene_id);
+            if (std::find(sub_scene_list_.begin(), sub_scene_list_.end(), wp.sub_scene_id) ==
+                sub_scene_list_.end()) {
+                sub_scene_list_.push_back(wp.sub_scene_id);
+            }
+        }
+
+        for (size_t i = 0; i < trajectory.paths.size(); ++i) {
+            PathEdge edge;
+            if (!hasPath(trajectory.paths[i].path_id) &&
+                makePathEdge(trajectory.paths[i], ANY_SUB_SCENE, bidirectional, edge)) {
+                path_edges_.push_back(edge);
+            }
+        }
+
+        rebuildCsr();
+        computeAllPairs();
+    }
+
+    /**
+     * 增量添加路径
+     * 只对新边做一次全源松弛，复杂度 O(V²)
+     * 路径两端须吸附到同一子场景的导航点，子场景按端点距离自动选择
+     * 路径ID已存在时拒绝添加，替换路径须先调用removePath()
+     * @param path 导航路径
+     * @param bidirectional 是否双向
+     * @return true表示路径端点成功吸附并加入路网，路径ID重复时返回false
+     */
+    bool addPath(const NavigationPath& path, bool bidirectional = true) {
+        return addPath(path, ANY_SUB_SCENE, bidirectional);
+    }
+
+    /**
+     * 增量添加指定子场景内的路径
+     * 多楼层地图中各层导航点平面坐标重叠时，用于明确路径所在楼层
+     * @param path 导航路径
+     * @param sub_scene_id 路径所在子场景ID
+     * @param bidirectional 是否双向
+     * @return true表示路径端点成功吸附并加入路网，路径ID重复时返回false
+     */
+    bool addPath(const NavigationPath& path, int32_t sub_scene_id, bool bidirectional = true) {
+        PathEdge edge;
+        if (hasPath(path.path_id) || !makePathEdge(path, sub_scene_id, bidirectional, edge)) {
+            return false;
+        }
+        path_edges_.push_back(edge);
+        rebuildCsr();
+        relaxEdge(edge.from, edge.to, edge.cost);
+        if (edge.bidirectional) {
+            relaxEdge(edge.to, edge.from, edge.cost);
+        }
+        return true;
+    }
+
+    /**
+     * 删除路径
+     * 删除会使经过该路径的最短路线失效，因此重新计算全源代价
+     * @param path_id 路径ID
+     * @return true表示删除成功，路径不存在返回false
+     */
+    bool removePath(int32_t path_id) {
+        size_t kept = 0;
+        for (size_t i = 0; i < path_edges_.size(); ++i) {
+            if (path_edges_[i].path_id != path_id) {
+                path_edges_[kept++] = path_edges_[i];
+            }
+        }
+        if (kept == path_edges_.size()) {
+            return false;
+        }
+        path_edges_.resize(kept);
+        rebuildCsr();
+        computeAllPairs();
+        return true;
+    }
+
+    /**
+     * 检查路径是否已加入路网
+     * @param path_id 路径ID
+     */
+    bool hasPath(int32_t path_id) const {
+        for (size_t i = 0; i < path_edges_.size(); ++i) {
+            if (path_edges_[i].path_id == path_id) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    // ============ 路线查询 ============
+
+    /**
+     * 获取两个导航点之间的最短路线代价
+     * @param from_point_id 起点导航点ID
+     * @param to_point_id 终点导航点ID
+     * @return 路线代价 (米)，导航点不存在或不可达时返回-1
+     */
+    float getRouteCost(int32_t from_point_id, int32_t to_point_id) const {
+        uint32_t from = 0;
+        uint32_t to = 0;
+        if (!lookup(from_point_id, from) || !lookup(to_point_id, to)) {
+            return -1.0f;
+        }
+        float cost = dist_[from * ids_.size() + to];
+        return std::isinf(cost) ? -1.0f : cost;
+    }
+
+    /**
+     * 获取两个导航点之间的最短路线
+     * @param from_point_id 起点导航点ID
+     * @param to_point_id 终点导航点ID
+     * @return 途经导航点ID序列 (含起终点)，不可达时返回空列表
+     */
+    std::vector<int32_t> getRoute(int32_t from_point_id, int32_t to_point_id) const {
+        std::vector<int32_t> route;
+        uint32_t from = 0;
+        uint32_t to = 0;
+        if (!lookup(from_point_id, from) || !lookup(to_point_id, to)) {
+            return route;
+        }
+        const size_t n = ids_.size();
+        if (std::isinf(dist_[from * n + to])) {
+            return route;
+        }
+        route.push_back(ids_[from]);
+        uint32_t cur = from;
+        while (cur != to) {
+            cur = static_cast<uint32_t>(next_[cur * n + to]);
+            route.push_back(ids_[cur]);
+        }
+        return route;
+    }
+
+    /**
+     * 检查两个导航点是否连通
+     */
+    bool isReachable(int32_t from_point_id, int32_t to_point_id) const {
+        return getRouteCost(from_point_id, to_point_id) >= 0.0f;
+    }
+
+    // ============ 索引访问 ============
+
+    /**
+     * 获取导航点数量
+     */
+    uint32_t getWayPointCount() const { return static_cast<uint32_t>(ids_.size()); }
+
+    /**
+     * 获取有向边数量
+     */
+    uint32_t getEdgeCount() const { return static_cast<uint32_t>(edges_.size()); }
+
+    /**
+     * 获取导航点ID列表 (下标即矩阵/CSR中的索引)
+     */
+    const std::vector<int32_t>& getWayPointIds() const { return ids_; }
+
+    /**
+     * 获取全源代价矩阵 (行优先，N×N，不可达为 +inf)
+     * 供巡逻调度器直接求解访问顺序
+     */
+    const std::vector<float>& getCostMatrix() const { return dist_; }
+
+    /**
+     * 获取CSR偏移数组 (长度 N+1)
+     * 索引 i 的出边为 getEdges()[offsets[i] .. offsets[i+1])
+     */
+    const std::vector<uint32_t>& getOffsets() const { return offsets_; }
+
+    /**
+     * 获取CSR边数组
+     */
+    const std::vector<RouteEdge>& getEdges() const { return edges_; }
+
+private:
+    struct PathEdge {
+        uint32_t from;
+        uint32_t to;
+        float cost;
+        int32_t path_id;
+        bool bidirectional;
+    };
+
+    static float distance(const Point3D& a, const Point3D& b) {
+        float dx = a.x - b.x;
+        float dy = a.y - b.y;
+        float dz = a.z - b.z;
+        return std::sqrt(dx * dx + dy * dy + dz * dz);
+    }
+
+    bool lookup(int32_t point_id, uint32_t& index) const {
+        std::unordered_map<int32_t, uint32_t>::const_iterator it = index_.find(point_id);
+        if (it == index_.end()) {
+            return false;
+        }
+        index = it->second;
+        return true;
+    }
+
+    // 自动选择子场景
+    static const int32_t ANY_SUB_SCENE = -1;
+
+    // 只在同一子场景内吸附，避免多楼层地图中跨楼层连边
+    bool snap(const Point3D& p, int32_t sub_scene_id, uint32_t& index, float& best) const {
+        best = snap_tolerance_;
+        bool found = false;
+        for (size_t i = 0; i < positions_.size(); ++i) {
+            if (sub_scenes_[i] != sub_scene_id) {
+                continue;
+            }
+            float d = distance(p, positions_[i]);
+            if (d <= best) {
+                best = d;
+                index = static_cast<uint32_t>(i);
+                found = true;
+            }
+        }
+        return found;
+    }
+
+    bool snapEnds(const NavigationPath& path, int32_t sub_scene_id,
+                  uint32_t& from, uint32_t& to, float& error) const {
+        float d_from = 0.0f, d_to = 0.0f;
+        if (!snap(path.points.front().position, sub_scene_id, from, d_from) ||
+            !snap(path.points.back().position, sub_scene_id, to, d_to) ||
+            from == to) {
+            return false;
+        }
+        error = d_from + d_to;
+        return true;
+    }
+
+    bool makePathEdge(const NavigationPath& path, int32_t sub_scene_id,
+                      bool bidirectional, PathEdge& edge) const {
+        if (path.points.size() < 2) {
+            return false;
+        }
+        if (sub_scene_id != ANY_SUB_SCENE) {
+            float error = 0.0f;
+            if (!snapEnds(path, sub_scene_id, edge.from, edge.to, error)) {
+                return false;
+            }
+        } else {
+            // 逐个子场景尝试，取两端吸附距离之和最小者
+            bool found = false;
+            float best = 0.0f;
+            for (size_t i = 0; i < sub_scene_list_.size(); ++i) {
+                uint32_t from = 0, to = 0;
+                float error = 0.0f;
+                if (snapEnds(path, sub_scene_list_[i], from, to, error) && (!found || error < best)) {
+                    found = true;
+                    best = error;
+                    edge.from = from;
+                    edge.to = to;
+                }
+            }
+            if (!found) {
+                return false;
+            }
+        }
+        float length = 0.0f;
+        for (size_t i = 1; i < path.points.size(); ++i) {
+            length += distance(path.points[i - 1].position, path.points[i].position);
+        }
+        edge.cost = length;
+        edge.path_id = path.path_id;
+        edge.bidirectional = bidirectional;
+        return true;
+    }
+
+    void rebuildCsr() {
+        const size_t n = ids_.size();
+        offsets_.assign(n + 1, 0);
+        for (size_t i = 0; i < path_edges_.size(); ++i) {
+            ++offsets_[path_edges_[i].from + 1];
+            if (path_edges_[i].bidirectional) {
+                ++offsets_[path_edges_[i].to + 1];
+            }
+        }
+        for (size_t i = 0; i < n; ++i) {
+            offsets_[i + 1] += offsets_[i];
+        }
+
+        edges_.resize(offsets_[n]);
+        std::vector<uint32_t> fill(offsets_.begin(), offsets_.end() - 1);
+        for (size_t i = 0; i < path_edges_.size(); ++i) {
+            const PathEdge& e = path_edges_[i];
+            RouteEdge forward = { e.to, e.cost, e.path_id };
+            edges_[fill[e.from]++] = forward;
+            if (e.bidirectional) {
+                RouteEdge backward = { e.from, e.cost, e.path_id };
+                edges_[fill[e.to]++] = backward;
+            }
+        }
+    }
+
+    // 每个源点一次Dijkstra，同时记录首跳用于路线还原
+    void computeAllPairs() {
+        const size_t n = ids_.size();
+        const float inf = std::numeric_limits<float>::infinity();
+        dist_.assign(n * n, inf);
+        next_.assign(n * n, -1);
+
+        using QueueItem = std::pair<float, uint32_t>;
+        for (uint32_t s = 0; s < n; ++s) {
+            float* dist = &dist_[s * n];
+            int32_t* next = &next_[s * n];
+            std::priority_queue<QueueItem, std::vector<QueueItem>, std::greater<QueueItem> > queue;
+            dist[s] = 0.0f;
+            next[s] = static_cast<int32_t>(s);
+            queue.push(QueueItem(0.0f, s));
+
+            while (!queue.empty()) {
+                QueueItem top = queue.top();
+                queue.pop();
+                uint32_t u = top.second;
+                if (top.first > dist[u]) {
+                    continue;
+                }
+                for (uint32_t k = offsets_[u]; k < offsets_[u + 1]; ++k) {
+                    const RouteEdge& e = edges_[k];
+                    float cand = dist[u] + e.cost;
+                    if (cand < dist[e.target]) {
+                        dist[e.target] = cand;
+                        next[e.target] = (u == s) ? static_cast<int32_t>(e.target) : next[u];
+                        queue.push(QueueItem(cand, e.target));
+                    }
+                }
+            }
+        }
+    }
+
+    // 插入单条有向边 u->v 后的全源增量更新
+    void relaxEdge(uint32_t u, uint32_t v, float cost) {
+        const size_t n = ids_.size();
+        if (!(cost < dist_[u * n + v])) {
+            return;
+        }
+        for (size_t i = 0; i < n; ++i) {
+            float to_u = dist_[i * n + u];
+            if (std::isinf(to_u)) {
+                continue;
+            }
+            int32_t hop = (i == u) ? static_cast<int32_t>(v) : next_[i * n + u];
+            for (size_t j = 0; j < n; ++j) {
+                float cand = to_u + cost + dist_[v * n + j];
+                if (cand < dist_[i * n + j]) {
+                    dist_[i * n + j] = cand;
+                    next_[i * n + j] = hop;
+                }
+            }
+        }
+    }
+
+    float snap_tolerance_;
+    std::vector<int32_t> ids_;
+    std::vector<Point3D> positions_;
+    std::vector<int32_t> sub_scenes_;       // 各导航点所属子场景
+    std::vector<int32_t> sub_scene_list_;   // 出现过的子场景 (去重)
+    std::unordered_map<int32_t, uint32_t> index_;
+    std::vector<PathEdge> path_edges_;
+    std::vector<uint32_t> offsets_;
+    std::vector<RouteEdge> edges_;
+    std::vector<float> dist_;
+    std::vector<int32_t> next_;
+};
+
+} // namespace q25
+} // namespace robot
+
+#endif // QUADRUPED_SDK_NAVIGATION_WAYPOINT_GRAPH_HPP
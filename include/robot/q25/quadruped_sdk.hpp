@@ -14,6 +14,8 @@
 // 核心模块 Core
 #include "common/types.hpp"            // 类型定义
 #include "common/robot.hpp"            // 连接管理
+#include "common/robot_context.hpp"    // 共享运行时
+#include "common/math.hpp"             // 几何工具
 
 // 运动控制 Motion Control
 #include "motion/motion_control.hpp"
@@ -22,10 +24,15 @@
 // 导航 Navigation
 #include "navigation/point_navigation.hpp"
 #include "navigation/track_navigation.hpp"
+#include "navigation/waypoint_graph.hpp"
+#include "navigation/path_processing.hpp"
 
 // 建图与定位 Mapping & Localization
 #include "mapping/slam.hpp"
 #include "mapping/map_manager.hpp"
+#include "mapping/pose_history.hpp"
+#include "mapping/scan_context.hpp"
+#include "mapping/tiled_map.hpp"
 
 // 传感器 Sensors
 #include "sensor/imu.hpp"
@@ -36,15 +43,20 @@
 
 // 安全监控 Safety
 #include "safety/safety_monitor.hpp"
+#include "safety/thermal_model.hpp"
+#include "safety/safety_watchdog.hpp"
 
 // 自主充电 Charging
 #include "charging/auto_charge.hpp"
+#include "charging/energy_model.hpp"
 
 // 系统信息 System
 #include "system/system_info.hpp"
 
 // 工具 Utilities
 #include "utils/error.hpp"
+#include "utils/varint.hpp"
+#include "utils/telemetry_codec.hpp"
 
 /**
  * SDK版本信息
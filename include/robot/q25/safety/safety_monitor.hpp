@@ -3,11 +3,15 @@
 
 #include "../common/types.hpp"
 #include <cstdint>
+#include <functional>
 #include <vector>
 
 namespace robot {
 namespace q25 {
 
+// 前向声明
+class Robot;
+
 /**
  * 过热类型
  */
@@ -76,6 +80,33 @@ struct SafetyStatus {
     uint32_t error_flags;       // 综合错误标志
 };
 
+/**
+ * 安全事件来源
+ */
+enum class SafetyEventSource {
+    THERMAL = 0,            // 过热 (code为OverheatType)
+    BATTERY = 1,            // 电池 (code为BatteryWarningType)
+    OVERLOAD = 2,           // 过载保护
+    FALL_PROTECTION = 3,    // 摔倒保护
+    EMERGENCY_STOP = 4      // 急停
+};
+
+/**
+ * 安全事件 (状态跳变)
+ */
+struct SafetyEvent {
+    uint64_t timestamp_us;      // 跳变发生时刻 (微秒，机器人时钟)
+    SafetyEventSource source;   // 事件来源
+    WarningState state;         // WARNING表示进入告警，CLEARED表示告警解除
+    uint32_t code;              // 来源内的告警类型
+    uint32_t joint_id;          // 关节ID (仅关节/驱动器过热时有效)
+    uint32_t joint_faults;      // 关节故障位图 (仅过载时有效)
+    float value;                // 相关数值 (温度/电压/电量)
+};
+
+// 安全事件回调
+using SafetyEventCallback = std::function<void(SafetyEvent)>;
+
 /**
  * SafetyMonitor - 安全监控接口
  * 提供安全状态监控功能
@@ -83,7 +114,17 @@ struct SafetyStatus {
  */
 class SafetyMonitor {
 public:
+    /**
+     * 构造函数，绑定到默认机器人实例 (进程内首个创建的Robot)
+     */
     SafetyMonitor();
+
+    /**
+     * 构造函数，绑定到指定机器人实例
+     * 同一进程可为多个Robot分别创建模块对象
+     * @param robot 机器人实例 (生命周期须长于本对象)
+     */
+    explicit SafetyMonitor(Robot& robot);
     ~SafetyMonitor();
 
     // 禁用复制
@@ -110,6 +151,13 @@ public:
      */
     std::vector<ThermalWarning> getThermalWarnings() const;
 
+    /**
+     * 获取过热告警列表 (复用调用方缓冲区，适合高频轮询)
+     * @param warnings [out] 过热告警信息列表，先清空再填充
+     * @return 告警数量
+     */
+    size_t getThermalWarnings(std::vector<ThermalWarning>& warnings) const;
+
     /**
      * 获取电池告警
      * @return 电池告警信息
@@ -122,6 +170,36 @@ public:
      */
     OverloadStatus getOverloadStatus() const;
 
+    // ============ 安全事件 ============
+
+    /**
+     * 订阅安全事件
+     * 机器人端按传感器原始频率检测状态跳变，每次进入/解除告警各上报一次，
+     * 持续时间短于上报周期的尖峰 (如瞬时过载) 也会成对上报，无需轮询
+     * @param callback 事件回调函数，传入空回调取消订阅
+     */
+    void subscribeSafetyEvent(SafetyEventCallback callback);
+
+    /**
+     * 设置事件历史容量
+     * 历史为SDK内存中的环形缓冲区，满后覆盖最旧的事件，不受是否订阅影响
+     * @param capacity 最大事件数 (默认256，0表示不保存)
+     */
+    void setEventHistorySize(size_t capacity);
+
+    /**
+     * 获取事件历史 (按时间升序)，用于故障复盘
+     * @param events [out] 事件列表，先清空再填充
+     * @param since_us 只返回该时刻之后的事件 (微秒，0表示全部)
+     * @return 事件数量
+     */
+    size_t getEventHistory(std::vector<SafetyEvent>& events, uint64_t since_us = 0) const;
+
+    /**
+     * 清空事件历史
+     */
+    void clearEventHistory();
+
 private:
     struct Impl;
     Impl* impl_;
@@ -0,0 +1,180 @@
+#ifndef QUADRUPED_SDK_SAFETY_WATCHDOG_HPP
+#define QUADRUPED_SDK_SAFETY_WATCHDOG_HPP
+
+#include "../common/types.hpp"
+#include <cstdint>
+#include <functional>
+
+namespace robot {
+namespace q25 {
+
+// 前向声明
+class Robot;
+
+/**
+ * 看门狗触发后的停止动作
+ */
+enum class WatchdogAction {
+    STOP_ALL_AXES = 0,      // 停止所有轴运动 (MotionController::stopAllAxes)
+    EMERGENCY_STOP = 1      // 急停 (MotionController::emergencyStop)
+};
+
+/**
+ * 看门狗违规类型
+ */
+enum class WatchdogViolation {
+    NONE = 0,               // 无
+    HEARTBEAT_LOST = 1,     // 链路心跳超时
+    COMMAND_STALE = 2,      // 应用层命令超时未刷新 (feed)
+    FALL_PROTECTION = 3,    // 摔倒保护激活
+    OVERLOAD = 4,           // 过载保护激活
+    THERMAL = 5,            // 过热告警
+    BATTERY = 6             // 电池告警
+};
+
+/**
+ * 看门狗配置
+ * 超时参数为0表示不检查该项
+ */
+struct WatchdogOptions {
+    uint32_t check_period_ms = 10;          // 检查周期 (毫秒)
+    uint32_t heartbeat_timeout_ms = 200;    // 链路心跳超时 (毫秒)
+    uint32_t command_timeout_ms = 0;        // 两次feed()之间的最大间隔 (毫秒)
+    bool stop_on_fall_protection = true;    // 摔倒保护激活时停止
+    bool stop_on_overload = true;           // 过载保护激活时停止
+    bool stop_on_thermal_warning = false;   // 过热告警时停止
+    bool stop_on_battery_warning = false;   // 电池告警时停止
+    WatchdogAction action = WatchdogAction::STOP_ALL_AXES;  // 停止动作
+    uint32_t escalation_timeout_ms = 100;   // 停止命令超时未确认时升级为急停 (毫秒)
+    int realtime_priority = 0;              // 实时优先级 (Linux SCHED_FIFO 1-99，0表示普通调度)
+    int cpu_affinity = -1;                  // 绑定的CPU核 (-1表示不绑定)
+};
+
+/**
+ * 看门狗触发事件
+ */
+struct WatchdogEvent {
+    uint64_t timestamp_us;          // 检测到违规的时刻 (微秒，本机单调时钟)
+    WatchdogViolation violation;    // 违规类型
+    WatchdogAction action;          // 实际执行的停止动作 (升级后为EMERGENCY_STOP)
+    bool acknowledged;              // 机器人是否确认收到停止命令
+    uint32_t latency_us;            // 从检测到收到确认的时延 (微秒)，未确认时为0
+};
+
+/**
+ * 看门狗运行统计
+ */
+struct WatchdogStats {
+    uint64_t checks;                // 已执行的检查次数
+    uint64_t trips;                 // 触发次数
+    uint32_t max_jitter_us;         // 检查周期最大抖动 (微秒)
+    bool realtime;                  // 实时优先级是否设置成功
+};
+
+// 看门狗触发事件回调类型
+using WatchdogEventCallback = std::function<void(WatchdogEvent)>;
+
+/**
+ * SafetyWatchdog - 客户端安全看门狗
+ * 在SDK内部的独立线程中周期检查链路心跳、SafetyStatus与应用层命令刷新，
+ * 发现违规时直接经优先命令通道发送停止命令，不经过应用线程与事件回调，
+ * 停止时延不受应用层停顿 (日志、内存回收等) 影响
+ * 仅支持INTERNAL事件循环模式：EXTERNAL模式下心跳接收与停止命令的收发
+ * 都依赖宿主线程调用processEvents()，无法绕开应用线程，start()将拒绝启动，
+ * 此时应由宿主事件循环自行保证停止时延或改用INTERNAL模式
+ * 默认不启用，需调用start()
+ */
+class SafetyWatchdog {
+public:
+    /**
+     * 构造函数，绑定到默认机器人实例 (进程内首个创建的Robot)
+     */
+    SafetyWatchdog();
+
+    /**
+     * 构造函数，绑定到指定机器人实例
+     * 同一进程可为多个Robot分别创建模块对象
+     * @param robot 机器人实例 (生命周期须长于本对象)
+     */
+    explicit SafetyWatchdog(Robot& robot);
+
+    /**
+     * 析构时自动停止看门狗
+     */
+    ~SafetyWatchdog();
+
+    // 禁用复制
+    SafetyWatchdog(const SafetyWatchdog&) = delete;
+    SafetyWatchdog& operator=(const SafetyWatchdog&) = delete;
+
+    // ============ 启停控制 ============
+
+    /**
+     * 启动看门狗线程
+     * 实时优先级需要相应权限 (如CAP_SYS_NICE)，设置失败时仍以普通调度运行，
+     * 可通过getStats().realtime确认
+     * @param options 看门狗配置
+     * @return true表示启动成功，已在运行或机器人的RobotContext为EXTERNAL模式时返回false
+     */
+    bool start(const WatchdogOptions& options = WatchdogOptions());
+
+    /**
+     * 停止看门狗线程
+     */
+    void stop();
+
+    /**
+     * 检查看门狗是否在运行
+     */
+    bool isRunning() const;
+
+    // ============ 命令刷新 ============
+
+    /**
+     * 刷新应用层命令时间戳
+     * 应用每次下发运动命令后调用，超过command_timeout_ms未调用视为违规；
+     * 仅做一次原子写，可在任意线程高频调用
+     */
+    void feed();
+
+    // ============ 触发状态 ============
+
+    /**
+     * 检查看门狗是否已触发
+     * 触发后保持锁定，不重复发送停止命令，直到调用rearm()
+     */
+    bool isTripped() const;
+
+    /**
+     * 获取最近一次触发的违规类型
+     * @return 违规类型，未触发时为NONE
+     */
+    WatchdogViolation getLastViolation() const;
+
+    /**
+     * 解除触发锁定，恢复检查
+     * 若为急停，须另行调用MotionController::releaseEmergencyStop()
+     */
+    void rearm();
+
+    /**
+     * 订阅看门狗触发事件
+     * 回调在停止命令发出后于SDK事件线程中执行，不影响停止时延
+     * @param callback 事件回调函数，传入空回调取消订阅
+     */
+    void subscribeWatchdogEvent(WatchdogEventCallback callback);
+
+    /**
+     * 获取运行统计
+     */
+    WatchdogStats getStats() const;
+
+private:
+    struct Impl;
+    Impl* impl_;
+};
+
+} // namespace q25
+} // namespace robot
+
+#endif // QUADRUPED_SDK_SAFETY_WATCHDOG_HPP
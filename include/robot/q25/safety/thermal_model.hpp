@@ -0,0 +1,257 @@
+#ifndef QUADRUPED_SDK_SAFETY_THERMAL_MODEL_HPP
+#define QUADRUPED_SDK_SAFETY_THERMAL_MODEL_HPP
+
+#include "../sensor/joint.hpp"
+#include <cmath>
+#include <cstdint>
+
+namespace robot {
+namespace q25 {
+
+/**
+ * 发热部件
+ */
+enum class ThermalNode {
+    MOTOR = 0,      // 关节电机
+    DRIVER = 1      // 驱动器
+};
+
+/**
+ * 热模型参数
+ * 先验参数在在线辨识收敛前使用，应按实际机型标定
+ */
+struct ThermalModelOptions {
+    float motor_limit = 80.0f;              // 电机温度上限 (℃)，应与过热告警阈值一致
+    float driver_limit = 75.0f;             // 驱动器温度上限 (℃)
+    float prior_time_constant = 600.0f;     // 先验热时间常数 (秒)
+    float prior_gain = 0.2f;                // 先验稳态温升系数 (℃/(Nm)²)
+    float prior_ambient = 25.0f;            // 先验环境温度 (℃)
+    float sample_interval = 5.0f;           // 辨识采样窗口 (秒)，温度分辨率越粗应越长
+    float load_time_constant = 10.0f;       // 负载 (力矩平方) 平滑时间常数 (秒)
+    float forgetting_factor = 0.99f;        // 递推最小二乘遗忘因子 (0-1)
+};
+
+/**
+ * 热裕量
+ */
+struct ThermalHeadroom {
+    float temperature;              // 当前温度 (℃)
+    float limit;                    // 温度上限 (℃)
+    float headroom;                 // 距上限的温差 (℃)
+    float steady_state_temp;        // 保持当前负载时的稳态温度 (℃)
+    float time_to_limit;            // 保持当前负载时到达上限的时间 (秒)，-1表示不会到达
+    float max_sustainable_torque;   // 稳态温度恰好等于上限的持续力矩 (Nm)，-1表示不受限
+};
+
+/**
+ * ThermalModel - 关节热模型
+ * 每个电机/驱动器使用一阶集总热模型 dT/dt = a·τ² - b·T + c，
+ * 参数 (a, b, c) 由关节力矩与温度历史递推最小二乘在线辨识，
+ * 据此预测当前负载下的稳态温度与到达上限的时间，可在过热告警前降速或调整任务
+ * 纯本地计算，不依赖机器人连接；update()与查询须在同一线程或由调用方加锁
+ */
+class ThermalModel {
+public:
+    /**
+     * 构造函数
+     * @param options 模型参数
+     */
+    explicit ThermalModel(const ThermalModelOptions& options = ThermalModelOptions())
+        : options_(options) {
+        reset();
+    }
+
+    /**
+     * 输入一帧关节数据
+     * 时间戳须单调递增，否则该帧被丢弃
+     * @param data 关节数据 (JointSensor::getAllJointsData()或遥测解码结果)
+     */
+    void update(const AllJointsData& data) {
+        if (has_time_ && !(data.timestamp > last_time_)) {
+            return;
+        }
+        float dt = has_time_ ? static_cast<float>(data.timestamp - last_time_) : 0.0f;
+        float alpha = dt / (options_.load_time_constant + dt);
+        for (uint32_t j = 0; j < JOINT_COUNT; ++j) {
+            const JointData& joint = data.joints[j];
+            float load = joint.torque * joint.torque;
+            updateNode(nodes_[j][0], data.timestamp, joint.motor_temp, load, alpha);
+            updateNode(nodes_[j][1], data.timestamp, joint.driver_temp, load, alpha);
+        }
+        last_time_ = data.timestamp;
+        has_time_ = true;
+    }
+
+    /**
+     * 获取指定部件的热裕量
+     * @param joint_id 关节ID (0-11)
+     * @param node 发热部件
+     * @return 热裕量，尚未输入数据或joint_id越界时温度为0
+     */
+    ThermalHeadroom getHeadroom(uint32_t joint_id, ThermalNode node) const {
+        ThermalHeadroom result = ThermalHeadroom();
+        float limit = node == ThermalNode::MOTOR ? options_.motor_limit : options_.driver_limit;
+        result.limit = limit;
+        result.time_to_limit = -1.0f;
+        result.max_sustainable_torque = -1.0f;
+        if (joint_id >= JOINT_COUNT) {
+            return result;
+        }
+        const Node& n = nodes_[joint_id][static_cast<int>(node)];
+        float a = 0.0f, b = 0.0f, c = 0.0f;
+        parameters(n, a, b, c);
+
+        result.temperature = n.temperature;
+        result.headroom = limit - n.temperature;
+        result.steady_state_temp = (a * n.load + c) / b;
+        if (n.temperature >= limit) {
+            result.time_to_limit = 0.0f;
+        } else if (result.steady_state_temp > limit) {
+            result.time_to_limit = std::log((result.steady_state_temp - n.temperature) /
+                                            (result.steady_state_temp - limit)) / b;
+        }
+        if (a > 0.0f) {
+            float margin = (b * limit - c) / a;
+            result.max_sustainable_torque = margin > 0.0f ? std::sqrt(margin) : 0.0f;
+        }
+        return result;
+    }
+
+    /**
+     * 获取最先到达温度上限的部件
+     * @param joint_id [out] 关节ID
+     * @param node [out] 发热部件
+     * @return 到达上限的时间 (秒)，-1表示当前负载下所有部件都不会到达
+     */
+    float getMinTimeToLimit(uint32_t& joint_id, ThermalNode& node) const {
+        float best = -1.0f;
+        joint_id = 0;
+        node = ThermalNode::MOTOR;
+        for (uint32_t j = 0; j < JOINT_COUNT; ++j) {
+            for (int k = 0; k < 2; ++k) {
+                ThermalNode current = static_cast<ThermalNode>(k);
+                float t = getHeadroom(j, current).time_to_limit;
+                if (t >= 0.0f && (best < 0.0f || t < best)) {
+                    best = t;
+                    joint_id = j;
+                    node = current;
+                }
+            }
+        }
+        return best;
+    }
+
+    /**
+     * 清空历史并恢复先验参数
+     */
+    void reset() {
+        float tc = options_.prior_time_constant > 1.0f ? options_.prior_time_constant : 1.0f;
+        for (uint32_t j = 0; j < JOINT_COUNT; ++j) {
+            for (int k = 0; k < 2; ++k) {
+                Node& n = nodes_[j][k];
+                n.theta[0] = options_.prior_gain / tc;
+                n.theta[1] = 1.0f / tc;
+                n.theta[2] = options_.prior_ambient / tc;
+                // 初始协方差与先验量级相当，先验在数个采样窗口后被数据覆盖
+                for (int r = 0; r < 3; ++r) {
+                    for (int s = 0; s < 3; ++s) {
+                        n.P[r][s] = 0.0f;
+                    }
+                }
+                n.P[0][0] = n.theta[0] * n.theta[0] * 1e-2f;
+                n.P[1][1] = n.theta[1] * n.theta[1] * 1e-2f;
+                n.P[2][2] = n.theta[2] * n.theta[2] * 1e-2f;
+                n.temperature = 0.0f;
+                n.load = 0.0f;
+                n.window_start = 0.0;
+                n.window_temp = 0.0f;
+                n.temp_sum = 0.0f;
+                n.load_sum = 0.0f;
+                n.samples = 0;
+            }
+        }
+        has_time_ = false;
+        last_time_ = 0.0;
+    }
+
+private:
+    struct Node {
+        float theta[3];         // a, b, c
+        float P[3][3];          // 参数协方差
+        float temperature;      // 最新温度
+        float load;             // 平滑后的力矩平方
+        double window_start;    // 当前采样窗口起始时刻
+        float window_temp;      // 窗口起始温度
+        float temp_sum;         // 窗口内温度和
+        float load_sum;         // 窗口内力矩平方和
+        uint32_t samples;       // 窗口内样本数
+    };
+
+    void updateNode(Node& n, double timestamp, float temperature, float load, float alpha) {
+        if (!has_time_) {
+            n.load = load;
+            n.window_start = timestamp;
+            n.window_temp = temperature;
+        } else {
+            n.load += alpha * (load - n.load);
+        }
+        n.temperature = temperature;
+        n.temp_sum += temperature;
+        n.load_sum += load;
+        ++n.samples;
+
+        float elapsed = static_cast<float>(timestamp - n.window_start);
+        if (elapsed < options_.sample_interval) {
+            return;
+        }
+        // 以窗口平均负载与平均温度为回归量，窗口首尾温差为观测
+        float x[3] = {n.load_sum / n.samples, -n.temp_sum / n.samples, 1.0f};
+        float y = (temperature - n.window_temp) / elapsed;
+        rlsUpdate(n, x, y);
+
+        n.window_start = timestamp;
+        n.window_temp = temperature;
+        n.temp_sum = 0.0f;
+        n.load_sum = 0.0f;
+        n.samples = 0;
+    }
+
+    void rlsUpdate(Node& n, const float x[3], float y) {
+        const float lambda = options_.forgetting_factor;
+        float Px[3];
+        for (int r = 0; r < 3; ++r) {
+            Px[r] = n.P[r][0] * x[0] + n.P[r][1] * x[1] + n.P[r][2] * x[2];
+        }
+        float denom = lambda + x[0] * Px[0] + x[1] * Px[1] + x[2] * Px[2];
+        if (!(denom > 1e-12f)) {
+            return;
+        }
+        float error = y - (n.theta[0] * x[0] + n.theta[1] * x[1] + n.theta[2] * x[2]);
+        for (int r = 0; r < 3; ++r) {
+            n.theta[r] += Px[r] / denom * error;
+        }
+        for (int r = 0; r < 3; ++r) {
+            for (int s = 0; s < 3; ++s) {
+                n.P[r][s] = (n.P[r][s] - Px[r] * Px[s] / denom) / lambda;
+            }
+        }
+    }
+
+    // 辨识结果不满足物理约束 (散热系数非正、发热系数为负) 时退回先验
+    void parameters(const Node& n, float& a, float& b, float& c) const {
+        float tc = options_.prior_time_constant > 1.0f ? options_.prior_time_constant : 1.0f;
+        b = n.theta[1] > 1e-5f ? n.theta[1] : 1.0f / tc;
+        a = n.theta[0] >= 0.0f ? n.theta[0] : 0.0f;
+        c = n.theta[1] > 1e-5f ? n.theta[2] : options_.prior_ambient * b;
+    }
+
+    ThermalModelOptions options_;
+    Node nodes_[JOINT_COUNT][2];
+    double last_time_;
+    bool has_time_;
+};
+
+} // namespace q25
+} // namespace robot
+
+#endif // QUADRUPED_SDK_SAFETY_THERMAL_MODEL_HPP
@@ -7,6 +7,9 @@
 namespace robot {
 namespace q25 {
 
+// 前向声明
+class Robot;
+
 /**
  * 详细电池信息
  */
@@ -27,7 +30,17 @@ struct BatteryInfo {
  */
 class BatterySensor {
 public:
+    /**
+     * 构造函数，绑定到默认机器人实例 (进程内首个创建的Robot)
+     */
     BatterySensor();
+
+    /**
+     * 构造函数，绑定到指定机器人实例
+     * 同一进程可为多个Robot分别创建模块对象
+     * @param robot 机器人实例 (生命周期须长于本对象)
+     */
+    explicit BatterySensor(Robot& robot);
     ~BatterySensor();
 
     // 禁用复制
@@ -8,6 +8,9 @@
 namespace robot {
 namespace q25 {
 
+// 前向声明
+class Robot;
+
 /**
  * 相机位置枚举
  * 对应 ROBOT_CAMERA_LOCATION
@@ -47,7 +50,17 @@ struct CameraInfo {
  */
 class CameraSensor {
 public:
+    /**
+     * 构造函数，绑定到默认机器人实例 (进程内首个创建的Robot)
+     */
     CameraSensor();
+
+    /**
+     * 构造函数，绑定到指定机器人实例
+     * 同一进程可为多个Robot分别创建模块对象
+     * @param robot 机器人实例 (生命周期须长于本对象)
+     */
+    explicit CameraSensor(Robot& robot);
     ~CameraSensor();
 
     // 禁用复制
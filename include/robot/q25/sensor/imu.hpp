@@ -7,6 +7,9 @@
 namespace robot {
 namespace q25 {
 
+// 前向声明
+class Robot;
+
 /**
  * IMUSensor - IMU传感器接口
  * 提供IMU数据访问功能
@@ -14,7 +17,17 @@ namespace q25 {
  */
 class IMUSensor {
 public:
+    /**
+     * 构造函数，绑定到默认机器人实例 (进程内首个创建的Robot)
+     */
     IMUSensor();
+
+    /**
+     * 构造函数，绑定到指定机器人实例
+     * 同一进程可为多个Robot分别创建模块对象
+     * @param robot 机器人实例 (生命周期须长于本对象)
+     */
+    explicit IMUSensor(Robot& robot);
     ~IMUSensor();
 
     // 禁用复制
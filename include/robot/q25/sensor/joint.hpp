@@ -8,6 +8,9 @@
 namespace robot {
 namespace q25 {
 
+// 前向声明
+class Robot;
+
 /**
  * 关节数量定义
  */
@@ -40,7 +43,17 @@ struct AllJointsData {
  */
 class JointSensor {
 public:
+    /**
+     * 构造函数，绑定到默认机器人实例 (进程内首个创建的Robot)
+     */
     JointSensor();
+
+    /**
+     * 构造函数，绑定到指定机器人实例
+     * 同一进程可为多个Robot分别创建模块对象
+     * @param robot 机器人实例 (生命周期须长于本对象)
+     */
+    explicit JointSensor(Robot& robot);
     ~JointSensor();
 
     // 禁用复制
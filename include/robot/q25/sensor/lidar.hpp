@@ -9,6 +9,9 @@
 namespace robot {
 namespace q25 {
 
+// 前向声明
+class Robot;
+
 /**
  * LiDAR点云数据点
  */
@@ -35,7 +38,17 @@ struct LiDARScan {
  */
 class LiDARSensor {
 public:
+    /**
+     * 构造函数，绑定到默认机器人实例 (进程内首个创建的Robot)
+     */
     LiDARSensor();
+
+    /**
+     * 构造函数，绑定到指定机器人实例
+     * 同一进程可为多个Robot分别创建模块对象
+     * @param robot 机器人实例 (生命周期须长于本对象)
+     */
+    explicit LiDARSensor(Robot& robot);
     ~LiDARSensor();
 
     // 禁用复制
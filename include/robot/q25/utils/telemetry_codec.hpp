@@ -0,0 +1,552 @@
+#ifndef QUADRUPED_SDK_UTILS_TELEMETRY_CODEC_HPP
+#define QUADRUPED_SDK_UTILS_TELEMETRY_CODEC_HPP
+
+#include "../common/types.hpp"
+#include "../motion/motion_state.hpp"
+#include "../sensor/joint.hpp"
+#include "../sensor/lidar.hpp"
+#include "varint.hpp"
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+/**
+ * 遥测数据紧凑二进制编码
+ * 用于将LiDAR、关节、IMU、运动状态等高频数据转发给机外客户端
+ *
+ * 帧格式 (整数为LEB128变长编码，有符号整数为zigzag变长编码，浮点为小端IEEE754):
+ *   帧头:  "QT" | schema(u8) | topic(u8) | flags(u8) | seq(varint)
+ *   LIDAR_SCAN:   timestamp(f64) | lidar_id | resolution(f32) | intensity_resolution(f32)
+ *                 | count | 每点 dx dy dz di (相对上一点的量化增量)
+ *   ALL_JOINTS:   timestamp(f64) | 12个关节 × {position, velocity, torque,
+ *                 motor_temp, driver_temp, error_code}
+ *                 关键帧写量化绝对值，增量帧 (flags & TELEMETRY_FLAG_DELTA) 写相对上一帧的差值
+ *   IMU:          timestamp(f64) | roll pitch yaw | omega_xyz | acc_xyz
+ *   MOTION_STATE: timestamp(f64) | basic_state motion_mode gait speed_level (u8)
+ *                 | velocity | pose | body_height body_roll body_pitch
+ *
+ * 量化精度:
+ *   位置 0.001 m，角度 0.001°，角速度 0.0001 rad/s，加速度 0.001 m/s²，
+ *   线速度 0.001 m/s，四元数分量 1/32767，关节位置 0.0001 rad，关节速度 0.001 rad/s，
+ *   力矩 0.01 Nm，温度 0.1 ℃；LiDAR坐标与强度精度由TelemetryCodecOptions指定并写入帧中
+ *   量化值须为有限值且在int32范围内
+ */
+
+namespace robot {
+namespace q25 {
+
+/**
+ * 遥测编码支持的版本范围
+ */
+constexpr uint8_t TELEMETRY_SCHEMA_VERSION_MIN = 1;
+constexpr uint8_t TELEMETRY_SCHEMA_VERSION_MAX = 1;
+
+/**
+ * 增量帧标志
+ */
+constexpr uint8_t TELEMETRY_FLAG_DELTA = 0x01;
+
+/**
+ * 编码参数
+ * 量化精度须为正的有限值
+ */
+struct TelemetryCodecOptions {
+    float lidar_resolution = 0.001f;            // LiDAR坐标量化精度 (米)
+    float lidar_intensity_resolution = 0.01f;   // LiDAR强度量化精度
+    uint32_t joints_keyframe_interval = 50;     // 关节数据关键帧间隔 (帧)
+};
+
+/**
+ * 协商双方共同支持的最高编码版本
+ * @param peer_min 对端支持的最低版本
+ * @param peer_max 对端支持的最高版本
+ * @param version [out] 协商结果
+ * @return true表示协商成功，无共同版本时返回false
+ */
+inline bool negotiateTelemetrySchema(uint8_t peer_min, uint8_t peer_max, uint8_t& version) {
+    uint8_t low = peer_min > TELEMETRY_SCHEMA_VERSION_MIN ? peer_min : TELEMETRY_SCHEMA_VERSION_MIN;
+    uint8_t high = peer_max < TELEMETRY_SCHEMA_VERSION_MAX ? peer_max : TELEMETRY_SCHEMA_VERSION_MAX;
+    if (low > high) {
+        return false;
+    }
+    version = high;
+    return true;
+}
+
+namespace detail {
+
+inline bool validResolution(float resolution) {
+    return resolution > 0.0f && std::isfinite(resolution);
+}
+
+// 量化到int32范围，非有限值或超出范围时返回false
+inline bool quantize(float v, float scale, int64_t& q) {
+    const double x = static_cast<double>(v) * scale;
+    if (!(std::fabs(x) <= std::numeric_limits<int32_t>::max())) {
+        return false;
+    }
+    q = static_cast<int64_t>(std::llround(x));
+    return true;
+}
+
+// 差值与累加以无符号数计算，损坏数据不会触发有符号溢出
+inline int64_t wrapDelta(int64_t value, int64_t prev) {
+    return static_cast<int64_t>(static_cast<uint64_t>(value) - static_cast<uint64_t>(prev));
+}
+
+inline int64_t wrapAdd(int64_t value, int64_t delta) {
+    return static_cast<int64_t>(static_cast<uint64_t>(value) + static_cast<uint64_t>(delta));
+}
+
+inline bool writeQuantized(std::vector<uint8_t>& out, float v, float scale) {
+    int64_t q = 0;
+    if (!quantize(v, scale, q)) {
+        return false;
+    }
+    writeSigned(out, q);
+    return true;
+}
+
+inline bool readQuantized(const uint8_t*& p, const uint8_t* end, float scale, float& v) {
+    int64_t q = 0;
+    if (!readSigned(p, end, q)) {
+        return false;
+    }
+    v = static_cast<float>(q) / scale;
+    return true;
+}
+
+inline bool readByte(const uint8_t*& p, const uint8_t* end, uint8_t& v) {
+    if (p == end) {
+        return false;
+    }
+    v = *p++;
+    return true;
+}
+
+// 关节各字段的量化倍率: position velocity torque motor_temp driver_temp error_code
+inline float jointScale(int field) {
+    static constexpr float scales[6] = { 10000.0f, 1000.0f, 100.0f, 10.0f, 10.0f, 1.0f };
+    return scales[field];
+}
+
+} // namespace detail
+
+/**
+ * TelemetryEncoder - 遥测数据编码器
+ * 编码结果写入调用方提供的缓冲区 (复用容量，稳态下不分配内存)
+ * 关节数据流为有状态编码，每个数据流应使用独立的编码器
+ * LiDAR扫描中的无效点 (NaN、无回波的无穷远点、超出量化范围) 被跳过；
+ * 其他数据含无效值时整帧编码失败，不占用帧序号
+ */
+class TelemetryEncoder {
+public:
+    /**
+     * 构造函数
+     * @param schema_version 编码版本 (通常为negotiateTelemetrySchema()的结果)
+     * @param options 编码参数，无效的量化精度使用默认值
+     */
+    explicit TelemetryEncoder(uint8_t schema_version = TELEMETRY_SCHEMA_VERSION_MAX,
+                              const TelemetryCodecOptions& options = TelemetryCodecOptions())
+        : schema_version_(schema_version), options_(options), joints_frames_(0) {
+        for (uint32_t i = 0; i < TELEMETRY_TOPIC_COUNT; ++i) {
+            seq_[i] = 0;
+        }
+        const TelemetryCodecOptions defaults;
+        if (!detail::validResolution(options_.lidar_resolution)) {
+            options_.lidar_resolution = defaults.lidar_resolution;
+        }
+        if (!detail::validResolution(options_.lidar_intensity_resolution)) {
+            options_.lidar_intensity_resolution = defaults.lidar_intensity_resolution;
+        }
+    }
+
+    /**
+     * 设置编码参数
+     * @param options 编码参数
+     * @return true表示设置成功，量化精度非正或非有限值时返回false并保留原参数
+     */
+    bool setOptions(const TelemetryCodecOptions& options) {
+        if (!detail::validResolution(options.lidar_resolution) ||
+            !detail::validResolution(options.lidar_intensity_resolution)) {
+            return false;
+        }
+        options_ = options;
+        return true;
+    }
+
+    /**
+     * 编码LiDAR扫描 (点间增量 + 量化)
+     * 无效点被跳过，帧中点数为有效点数
+     */
+    void encode(const LiDARScan& scan, std::vector<uint8_t>& out) {
+        const float scale = 1.0f / options_.lidar_resolution;
+        const float intensity_scale = 1.0f / options_.lidar_intensity_resolution;
+        size_t valid = 0;
+        int64_t q[4];
+        for (size_t i = 0; i < scan.points.size(); ++i) {
+            if (quantizePoint(scan.points[i], scale, intensity_scale, q)) {
+                ++valid;
+            }
+        }
+
+        beginFrame(out, TelemetryTopic::LIDAR_SCAN, 0);
+        out.reserve(out.size() + 24 + valid * 6);
+        detail::writeDouble(out, scan.timestamp);
+        detail::writeVarint(out, scan.lidar_id);
+        detail::writeFloat(out, options_.lidar_resolution);
+        detail::writeFloat(out, options_.lidar_intensity_resolution);
+        detail::writeVarint(out, valid);
+
+        int64_t prev[4] = { 0, 0, 0, 0 };
+        for (size_t i = 0; i < scan.points.size(); ++i) {
+            if (!quantizePoint(scan.points[i], scale, intensity_scale, q)) {
+                continue;
+            }
+            for (int k = 0; k < 4; ++k) {
+                detail::writeSigned(out, detail::wrapDelta(q[k], prev[k]));
+                prev[k] = q[k];
+            }
+        }
+    }
+
+    /**
+     * 编码关节数据 (量化，关键帧之间使用帧间增量)
+     * @return true表示编码成功，含无效值时返回false，out被清空且编码状态不变
+     */
+    bool encode(const AllJointsData& data, std::vector<uint8_t>& out) {
+        int64_t q[JOINT_COUNT][6];
+        for (uint32_t j = 0; j < JOINT_COUNT; ++j) {
+            const JointData& joint = data.joints[j];
+            const float values[5] = {
+                joint.position, joint.velocity, joint.torque, joint.motor_temp, joint.driver_temp
+            };
+            for (int k = 0; k < 5; ++k) {
+                if (!detail::quantize(values[k], detail::jointScale(k), q[j][k])) {
+                    out.clear();
+                    return false;
+                }
+            }
+            q[j][5] = joint.error_code;
+        }
+
+        bool keyframe = options_.joints_keyframe_interval == 0 ||
+                        joints_frames_ % options_.joints_keyframe_interval == 0;
+        ++joints_frames_;
+        beginFrame(out, TelemetryTopic::ALL_JOINTS, keyframe ? 0 : TELEMETRY_FLAG_DELTA);
+        detail::writeDouble(out, data.timestamp);
+        for (uint32_t j = 0; j < JOINT_COUNT; ++j) {
+            for (int k = 0; k < 6; ++k) {
+                detail::writeSigned(out, keyframe ? q[j][k] : detail::wrapDelta(q[j][k], joints_prev_[j][k]));
+                joints_prev_[j][k] = q[j][k];
+            }
+        }
+        return true;
+    }
+
+    /**
+     * 编码IMU数据 (量化)
+     * @return true表示编码成功，含无效值时返回false并清空out
+     */
+    bool encode(const IMUData& data, std::vector<uint8_t>& out) {
+        beginFrame(out, TelemetryTopic::IMU, 0);
+        detail::writeDouble(out, data.timestamp);
+        if (!detail::writeQuantized(out, data.roll, 1000.0f) ||
+            !detail::writeQuantized(out, data.pitch, 1000.0f) ||
+            !detail::writeQuantized(out, data.yaw, 1000.0f) ||
+            !detail::writeQuantized(out, data.omega_x, 10000.0f) ||
+            !detail::writeQuantized(out, data.omega_y, 10000.0f) ||
+            !detail::writeQuantized(out, data.omega_z, 10000.0f) ||
+            !detail::writeQuantized(out, data.acc_x, 1000.0f) ||
+            !detail::writeQuantized(out, data.acc_y, 1000.0f) ||
+            !detail::writeQuantized(out, data.acc_z, 1000.0f)) {
+            abortFrame(out, TelemetryTopic::IMU);
+            return false;
+        }
+        return true;
+    }
+
+    /**
+     * 编码运动状态 (量化)
+     * @return true表示编码成功，含无效值时返回false并清空out
+     */
+    bool encode(const MotionState& state, std::vector<uint8_t>& out) {
+        beginFrame(out, TelemetryTopic::MOTION_STATE, 0);
+        detail::writeDouble(out, state.timestamp);
+        out.push_back(static_cast<uint8_t>(state.basic_state));
+        out.push_back(static_cast<uint8_t>(state.motion_mode));
+        out.push_back(static_cast<uint8_t>(state.gait));
+        out.push_back(static_cast<uint8_t>(state.speed_level));
+        if (!detail::writeQuantized(out, state.velocity.linear_x, 1000.0f) ||
+            !detail::writeQuantized(out, state.velocity.linear_y, 1000.0f) ||
+            !detail::writeQuantized(out, state.velocity.angular_z, 10000.0f) ||
+            !detail::writeQuantized(out, state.pose.position.x, 1000.0f) ||
+            !detail::writeQuantized(out, state.pose.position.y, 1000.0f) ||
+            !detail::writeQuantized(out, state.pose.position.z, 1000.0f) ||
+            !detail::writeQuantized(out, state.pose.orientation.x, 32767.0f) ||
+            !detail::writeQuantized(out, state.pose.orientation.y, 32767.0f) ||
+            !detail::writeQuantized(out, state.pose.orientation.z, 32767.0f) ||
+            !detail::writeQuantized(out, state.pose.orientation.w, 32767.0f) ||
+            !detail::writeQuantized(out, state.body_height, 1000.0f) ||
+            !detail::writeQuantized(out, state.body_roll, 1000.0f) ||
+            !detail::writeQuantized(out, state.body_pitch, 1000.0f)) {
+            abortFrame(out, TelemetryTopic::MOTION_STATE);
+            return false;
+        }
+        return true;
+    }
+
+    /**
+     * 强制下一帧关节数据为关键帧 (如接收端请求重同步)
+     */
+    void requestKeyframe() { joints_frames_ = 0; }
+
+    /**
+     * 获取编码版本
+     */
+    uint8_t getSchemaVersion() const { return schema_version_; }
+
+private:
+    void beginFrame(std::vector<uint8_t>& out, TelemetryTopic topic, uint8_t flags) {
+        out.clear();
+        out.push_back('Q');
+        out.push_back('T');
+        out.push_back(schema_version_);
+        out.push_back(static_cast<uint8_t>(topic));
+        out.push_back(flags);
+        detail::writeVarint(out, seq_[static_cast<int>(topic)]++);
+    }
+
+    void abortFrame(std::vector<uint8_t>& out, TelemetryTopic topic) {
+        out.clear();
+        --seq_[static_cast<int>(topic)];
+    }
+
+    static bool quantizePoint(const LiDARPoint& pt, float scale, float intensity_scale, int64_t q[4]) {
+        return detail::quantize(pt.x, scale, q[0]) && detail::quantize(pt.y, scale, q[1]) &&
+               detail::quantize(pt.z, scale, q[2]) && detail::quantize(pt.intensity, intensity_scale, q[3]);
+    }
+
+    uint8_t schema_version_;
+    TelemetryCodecOptions options_;
+    uint32_t seq_[TELEMETRY_TOPIC_COUNT];
+    uint32_t joints_frames_;
+    int64_t joints_prev_[JOINT_COUNT][6];
+};
+
+/**
+ * TelemetryDecoder - 遥测数据解码器
+ * 直接解码到调用方提供的SDK结构体中，复用其已有容量
+ * 关节增量帧需要连续接收，丢帧后在下一个关键帧之前解码失败
+ */
+class TelemetryDecoder {
+public:
+    TelemetryDecoder() : joints_valid_(false), joints_seq_(0) {}
+
+    /**
+     * 读取帧的主题
+     * @param data 帧数据
+     * @param size 数据长度 (字节)
+     * @return 主题，非遥测帧或版本不支持时返回UNKNOWN
+     */
+    static TelemetryTopic peekTopic(const uint8_t* data, size_t size) {
+        if (size < 6 || data[0] != 'Q' || data[1] != 'T' ||
+            data[2] < TELEMETRY_SCHEMA_VERSION_MIN || data[2] > TELEMETRY_SCHEMA_VERSION_MAX ||
+            data[3] < static_cast<uint8_t>(TelemetryTopic::LIDAR_SCAN) ||
+            data[3] > static_cast<uint8_t>(TelemetryTopic::MOTION_STATE)) {
+            return TelemetryTopic::UNKNOWN;
+        }
+        return static_cast<TelemetryTopic>(data[3]);
+    }
+
+    /**
+     * 解码LiDAR扫描
+     * @return true表示解码成功，格式错误或量化精度无效时返回false
+     */
+    bool decode(const uint8_t* data, size_t size, LiDARScan& scan) {
+        const uint8_t* p = data;
+        const uint8_t* end = data + size;
+        uint8_t flags = 0;
+        uint64_t seq = 0;
+        if (!readHeader(p, end, TelemetryTopic::LIDAR_SCAN, flags, seq)) {
+            return false;
+        }
+
+        double timestamp = 0.0;
+        uint64_t lidar_id = 0;
+        float resolution = 0.0f;
+        float intensity_resolution = 0.0f;
+        uint64_t count = 0;
+        if (!detail::readDouble(p, end, timestamp) ||
+            !detail::readVarint(p, end, lidar_id) ||
+            !detail::readFloat(p, end, resolution) ||
+            !detail::readFloat(p, end, intensity_resolution) ||
+            !detail::validResolution(resolution) ||
+            !detail::validResolution(intensity_resolution) ||
+            !detail::readVarint(p, end, count) ||
+            count > static_cast<uint64_t>(end - p) / 4) {
+            return false;
+        }
+
+        scan.points.resize(static_cast<size_t>(count));
+        int64_t acc[4] = { 0, 0, 0, 0 };
+        for (size_t i = 0; i < scan.points.size(); ++i) {
+            for (int k = 0; k < 4; ++k) {
+                int64_t delta = 0;
+                if (!detail::readSigned(p, end, delta)) {
+                    scan.points.clear();
+                    return false;
+                }
+                acc[k] = detail::wrapAdd(acc[k], delta);
+            }
+            LiDARPoint& pt = scan.points[i];
+            pt.x = acc[0] * resolution;
+            pt.y = acc[1] * resolution;
+            pt.z = acc[2] * resolution;
+            pt.intensity = acc[3] * intensity_resolution;
+        }
+        scan.timestamp = timestamp;
+        scan.lidar_id = static_cast<uint32_t>(lidar_id);
+        return true;
+    }
+
+    /**
+     * 解码关节数据
+     * @return true表示解码成功，增量帧缺少参考帧时返回false
+     */
+    bool decode(const uint8_t* data, size_t size, AllJointsData& out) {
+        const uint8_t* p = data;
+        const uint8_t* end = data + size;
+        uint8_t flags = 0;
+        uint64_t seq = 0;
+        if (!readHeader(p, end, TelemetryTopic::ALL_JOINTS, flags, seq)) {
+            return false;
+        }
+        bool delta = (flags & TELEMETRY_FLAG_DELTA) != 0;
+        if (delta && (!joints_valid_ || static_cast<uint32_t>(seq) != joints_seq_ + 1)) {
+            joints_valid_ = false;
+            return false;
+        }
+
+        double timestamp = 0.0;
+        if (!detail::readDouble(p, end, timestamp)) {
+            return false;
+        }
+        int64_t values[JOINT_COUNT][6];
+        for (uint32_t j = 0; j < JOINT_COUNT; ++j) {
+            for (int k = 0; k < 6; ++k) {
+                int64_t v = 0;
+                if (!detail::readSigned(p, end, v)) {
+                    joints_valid_ = false;
+                    return false;
+                }
+                values[j][k] = delta ? detail::wrapAdd(joints_prev_[j][k], v) : v;
+            }
+        }
+
+        out.timestamp = timestamp;
+        for (uint32_t j = 0; j < JOINT_COUNT; ++j) {
+            JointData& joint = out.joints[j];
+            joint.position = values[j][0] / detail::jointScale(0);
+            joint.velocity = values[j][1] / detail::jointScale(1);
+            joint.torque = values[j][2] / detail::jointScale(2);
+            joint.motor_temp = values[j][3] / detail::jointScale(3);
+            joint.driver_temp = values[j][4] / detail::jointScale(4);
+            joint.error_code = static_cast<int32_t>(values[j][5]);
+            for (int k = 0; k < 6; ++k) {
+                joints_prev_[j][k] = values[j][k];
+            }
+        }
+        joints_valid_ = true;
+        joints_seq_ = static_cast<uint32_t>(seq);
+        return true;
+    }
+
+    /**
+     * 解码IMU数据
+     * @return true表示解码成功
+     */
+    bool decode(const uint8_t* data, size_t size, IMUData& out) const {
+        const uint8_t* p = data;
+        const uint8_t* end = data + size;
+        uint8_t flags = 0;
+        uint64_t seq = 0;
+        IMUData imu;
+        if (!readHeader(p, end, TelemetryTopic::IMU, flags, seq) ||
+            !detail::readDouble(p, end, imu.timestamp) ||
+            !detail::readQuantized(p, end, 1000.0f, imu.roll) ||
+            !detail::readQuantized(p, end, 1000.0f, imu.pitch) ||
+            !detail::readQuantized(p, end, 1000.0f, imu.yaw) ||
+            !detail::readQuantized(p, end, 10000.0f, imu.omega_x) ||
+            !detail::readQuantized(p, end, 10000.0f, imu.omega_y) ||
+            !detail::readQuantized(p, end, 10000.0f, imu.omega_z) ||
+            !detail::readQuantized(p, end, 1000.0f, imu.acc_x) ||
+            !detail::readQuantized(p, end, 1000.0f, imu.acc_y) ||
+            !detail::readQuantized(p, end, 1000.0f, imu.acc_z)) {
+            return false;
+        }
+        out = imu;
+        return true;
+    }
+
+    /**
+     * 解码运动状态
+     * @return true表示解码成功
+     */
+    bool decode(const uint8_t* data, size_t size, MotionState& out) const {
+        const uint8_t* p = data;
+        const uint8_t* end = data + size;
+        uint8_t flags = 0;
+        uint64_t seq = 0;
+        uint8_t basic_state = 0, motion_mode = 0, gait = 0, speed_level = 0;
+        MotionState state;
+        if (!readHeader(p, end, TelemetryTopic::MOTION_STATE, flags, seq) ||
+            !detail::readDouble(p, end, state.timestamp) ||
+            !detail::readByte(p, end, basic_state) ||
+            !detail::readByte(p, end, motion_mode) ||
+            !detail::readByte(p, end, gait) ||
+            !detail::readByte(p, end, speed_level) ||
+            !detail::readQuantized(p, end, 1000.0f, state.velocity.linear_x) ||
+            !detail::readQuantized(p, end, 1000.0f, state.velocity.linear_y) ||
+            !detail::readQuantized(p, end, 10000.0f, state.velocity.angular_z) ||
+            !detail::readQuantized(p, end, 1000.0f, state.pose.position.x) ||
+            !detail::readQuantized(p, end, 1000.0f, state.pose.position.y) ||
+            !detail::readQuantized(p, end, 1000.0f, state.pose.position.z) ||
+            !detail::readQuantized(p, end, 32767.0f, state.pose.orientation.x) ||
+            !detail::readQuantized(p, end, 32767.0f, state.pose.orientation.y) ||
+            !detail::readQuantized(p, end, 32767.0f, state.pose.orientation.z) ||
+            !detail::readQuantized(p, end, 32767.0f, state.pose.orientation.w) ||
+            !detail::readQuantized(p, end, 1000.0f, state.body_height) ||
+            !detail::readQuantized(p, end, 1000.0f, state.body_roll) ||
+            !detail::readQuantized(p, end, 1000.0f, state.body_pitch)) {
+            return false;
+        }
+        state.basic_state = static_cast<RobotBasicState>(basic_state);
+        state.motion_mode = static_cast<MotionMode>(motion_mode);
+        state.gait = static_cast<GaitType>(gait);
+        state.speed_level = static_cast<SpeedLevel>(speed_level);
+        out = state;
+        return true;
+    }
+
+private:
+    static bool readHeader(const uint8_t*& p, const uint8_t* end, TelemetryTopic topic,
+                           uint8_t& flags, uint64_t& seq) {
+        if (peekTopic(p, static_cast<size_t>(end - p)) != topic) {
+            return false;
+        }
+        flags = p[4];
+        p += 5;
+        return detail::readVarint(p, end, seq);
+    }
+
+    bool joints_valid_;
+    uint32_t joints_seq_;
+    int64_t joints_prev_[JOINT_COUNT][6];
+};
+
+} // namespace q25
+} // namespace robot
+
+#endif // QUADRUPED_SDK_UTILS_TELEMETRY_CODEC_HPP
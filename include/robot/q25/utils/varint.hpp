@@ -0,0 +1,132 @@
+#ifndef QUADRUPED_SDK_UTILS_VARINT_HPP
+#define QUADRUPED_SDK_UTILS_VARINT_HPP
+
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+namespace robot {
+namespace q25 {
+namespace detail {
+
+/**
+ * 紧凑二进制编码的公共工具
+ * 变长整数使用LEB128编码，有符号整数先做zigzag变换
+ * 定长整数与浮点数 (IEEE754) 按小端字节序写入
+ */
+
+inline void writeVarint(std::vector<uint8_t>& out, uint64_t v) {
+    while (v >= 0x80) {
+        out.push_back(static_cast<uint8_t>(v | 0x80));
+        v >>= 7;
+    }
+    out.push_back(static_cast<uint8_t>(v));
+}
+
+inline void writeSigned(std::vector<uint8_t>& out, int64_t v) {
+    writeVarint(out, (static_cast<uint64_t>(v) << 1) ^ static_cast<uint64_t>(v >> 63));
+}
+
+inline void writeU32(std::vector<uint8_t>& out, uint32_t v) {
+    for (int i = 0; i < 4; ++i) {
+        out.push_back(static_cast<uint8_t>(v >> (8 * i)));
+    }
+}
+
+inline void writeU64(std::vector<uint8_t>& out, uint64_t v) {
+    for (int i = 0; i < 8; ++i) {
+        out.push_back(static_cast<uint8_t>(v >> (8 * i)));
+    }
+}
+
+inline void writeFloat(std::vector<uint8_t>& out, float v) {
+    uint32_t bits = 0;
+    std::memcpy(&bits, &v, sizeof(bits));
+    for (int i = 0; i < 4; ++i) {
+        out.push_back(static_cast<uint8_t>(bits >> (8 * i)));
+    }
+}
+
+inline void writeDouble(std::vector<uint8_t>& out, double v) {
+    uint64_t bits = 0;
+    std::memcpy(&bits, &v, sizeof(bits));
+    for (int i = 0; i < 8; ++i) {
+        out.push_back(static_cast<uint8_t>(bits >> (8 * i)));
+    }
+}
+
+inline bool readVarint(const uint8_t*& p, const uint8_t* end, uint64_t& v) {
+    v = 0;
+    for (int shift = 0; shift < 64; shift += 7) {
+        if (p == end) {
+            return false;
+        }
+        uint8_t byte = *p++;
+        v |= static_cast<uint64_t>(byte & 0x7F) << shift;
+        if (!(byte & 0x80)) {
+            return true;
+        }
+    }
+    return false;
+}
+
+inline bool readSigned(const uint8_t*& p, const uint8_t* end, int64_t& v) {
+    uint64_t u = 0;
+    if (!readVarint(p, end, u)) {
+        return false;
+    }
+    v = static_cast<int64_t>(u >> 1) ^ -static_cast<int64_t>(u & 1);
+    return true;
+}
+
+inline bool readU32(const uint8_t*& p, const uint8_t* end, uint32_t& v) {
+    if (end - p < 4) {
+        return false;
+    }
+    v = 0;
+    for (int i = 0; i < 4; ++i) {
+        v |= static_cast<uint32_t>(*p++) << (8 * i);
+    }
+    return true;
+}
+
+inline bool readU64(const uint8_t*& p, const uint8_t* end, uint64_t& v) {
+    if (end - p < 8) {
+        return false;
+    }
+    v = 0;
+    for (int i = 0; i < 8; ++i) {
+        v |= static_cast<uint64_t>(*p++) << (8 * i);
+    }
+    return true;
+}
+
+inline bool readFloat(const uint8_t*& p, const uint8_t* end, float& v) {
+    if (end - p < 4) {
+        return false;
+    }
+    uint32_t bits = 0;
+    for (int i = 0; i < 4; ++i) {
+        bits |= static_cast<uint32_t>(*p++) << (8 * i);
+    }
+    std::memcpy(&v, &bits, sizeof(v));
+    return true;
+}
+
+inline bool readDouble(const uint8_t*& p, const uint8_t* end, double& v) {
+    if (end - p < 8) {
+        return false;
+    }
+    uint64_t bits = 0;
+    for (int i = 0; i < 8; ++i) {
+        bits |= static_cast<uint64_t>(*p++) << (8 * i);
+    }
+    std::memcpy(&v, &bits, sizeof(v));
+    return true;
+}
+
+} // namespace detail
+} // namespace q25
+} // namespace robot
+
+#endif // QUADRUPED_SDK_UTILS_VARINT_HPP